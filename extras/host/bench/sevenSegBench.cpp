@@ -0,0 +1,243 @@
+/**
+  ******************************************************************************
+  * @file	: sevenSegBench.cpp
+  * @brief	: Host benchmark suite for the SevenSegDisplays_STM32 library hot paths
+  *
+  * @details Runs each benchmarked method over the host HAL/FreeRTOS stand-in layer and reports, for each one, a JSON object per line with:
+  * - "bench": benchmark name.
+  * - "iters": invocations measured.
+  * - "ns_per_op": host wall clock nanoseconds per invocation, best of the repetitions run.
+  * - "allocs_per_op": heap allocations (operator new invocations) per invocation.
+  * - "gpio_trnstns_per_op": GPIO pin level changes per invocation.
+  * - "gpio_calls_per_op": HAL GPIO services invocations per invocation.
+  * - "crtcl_sctns_per_op": outermost critical sections entered per invocation.
+  *
+  * Usage: sevenSegBench [iterations] [repetitions]
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "sevenSegDisplays.h"
+#include "sevenSegDispHw.h"
+#include "hostStandIn.h"
+
+//--------------------------------------------------------------- Heap allocations counting
+static uint64_t allocsCount{0};
+
+void* operator new(std::size_t size){
+	++allocsCount;
+	void* memPtr = std::malloc(size? size : 1);
+	if(!memPtr)
+		throw std::bad_alloc();
+
+	return memPtr;
+}
+
+void* operator new[](std::size_t size){
+
+	return operator new(size);
+}
+
+void operator delete(void* memPtr) noexcept{
+	std::free(memPtr);
+}
+
+void operator delete[](void* memPtr) noexcept{
+	std::free(memPtr);
+}
+
+void operator delete(void* memPtr, std::size_t size) noexcept{
+	std::free(memPtr);
+}
+
+void operator delete[](void* memPtr, std::size_t size) noexcept{
+	std::free(memPtr);
+}
+
+//--------------------------------------------------------------- Protected members access for benchmarking
+class BenchDisplay: public SevenSegDisplays{
+public:
+	BenchDisplay(SevenSegDispHw* dspUndrlHwPtr): SevenSegDisplays(dspUndrlHwPtr){}
+	void benchUpdBlinkState(){ updBlinkState(); }
+	void benchUpdWaitState(){ updWaitState(); }
+};
+
+class BenchDynHC595: public SevenSegDynHC595{
+public:
+	BenchDynHC595(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode): SevenSegDynHC595(ioPins, dspDigits, commAnode){}
+	void benchRefreshSlot(const uint8_t &slot){ refreshSlot(slot, 0); }
+};
+
+class BenchDynHC595Chain: public SevenSegDynHC595Chain{
+public:
+	BenchDynHC595Chain(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode, uint8_t chnMdls): SevenSegDynHC595Chain(ioPins, dspDigits, commAnode, chnMdls){}
+	void benchRefreshSlot(const uint8_t &slot){ refreshSlot(slot, 0); }
+};
+
+class BenchDynHC595Spi: public SevenSegDynHC595Spi{
+public:
+	BenchDynHC595Spi(SPI_HandleTypeDef* spiHndlPtr, const gpioPinId_t &rclk, uint8_t dspDigits, bool commAnode): SevenSegDynHC595Spi(spiHndlPtr, rclk, dspDigits, commAnode){}
+	void benchRefreshSlot(const uint8_t &slot){ refreshSlot(slot, 0); }
+};
+
+class BenchTM163X: public SevenSegTM163X{
+public:
+	BenchTM163X(gpioPinId_t* ioPins, uint8_t dspDigits): SevenSegTM163X(ioPins, dspDigits){}
+	uint8_t benchBldMssg(const uint16_t &chngdDgtsMsk){ return _bldMssg(chngdDgtsMsk); }
+};
+
+//--------------------------------------------------------------- Benchmark harness
+static uint32_t benchIters{20000};
+static uint32_t benchReps{5};
+
+template <typename F>
+static void runBench(const char* benchName, F benchOp){
+	double bestNsPerOp{0.0};
+	uint64_t allocsStrt{0};
+	uint32_t trnstnsStrt{0};
+	uint32_t gpioCallsStrt{0};
+	uint32_t crtclSctnsStrt{0};
+	double allocsPerOp{0.0};
+	double trnstnsPerOp{0.0};
+	double gpioCallsPerOp{0.0};
+	double crtclSctnsPerOp{0.0};
+
+	for(uint32_t rep{0}; rep < benchReps; rep++){
+		allocsStrt = allocsCount;
+		trnstnsStrt = hostSimTrnstnsCount();
+		gpioCallsStrt = hostSimGpioCallsCount();
+		crtclSctnsStrt = hostSimCrtclSctnsCount();
+		auto tmStrt = std::chrono::steady_clock::now();
+		for(uint32_t i{0}; i < benchIters; i++)
+			benchOp(i);
+		auto tmEnd = std::chrono::steady_clock::now();
+		double nsPerOp = std::chrono::duration<double, std::nano>(tmEnd - tmStrt).count() / benchIters;
+		if((rep == 0) || (nsPerOp < bestNsPerOp))
+			bestNsPerOp = nsPerOp;
+		allocsPerOp = double(allocsCount - allocsStrt) / benchIters;
+		trnstnsPerOp = double(hostSimTrnstnsCount() - trnstnsStrt) / benchIters;
+		gpioCallsPerOp = double(hostSimGpioCallsCount() - gpioCallsStrt) / benchIters;
+		crtclSctnsPerOp = double(hostSimCrtclSctnsCount() - crtclSctnsStrt) / benchIters;
+	}
+	std::printf("{\"bench\":\"%s\",\"iters\":%u,\"ns_per_op\":%.1f,\"allocs_per_op\":%.3f,\"gpio_trnstns_per_op\":%.3f,\"gpio_calls_per_op\":%.3f,\"crtcl_sctns_per_op\":%.3f}\n",
+			benchName, benchIters, bestNsPerOp, allocsPerOp, trnstnsPerOp, gpioCallsPerOp, crtclSctnsPerOp);
+
+	return;
+}
+
+int main(int argc, char* argv[]){
+	if(argc > 1)
+		benchIters = std::strtoul(argv[1], nullptr, 10);
+	if(argc > 2)
+		benchReps = std::strtoul(argv[2], nullptr, 10);
+	if(benchIters == 0)
+		benchIters = 1;
+	if(benchReps == 0)
+		benchReps = 1;
+
+	hostSimReset();
+	gpioPinId_t dspPins[]{{GPIOA, GPIO_PIN_5}, {GPIOA, GPIO_PIN_6}, {GPIOB, GPIO_PIN_12}};
+	BenchDynHC595 dspHw(dspPins, 4, true);
+	BenchDisplay dsp(&dspHw);
+	ClickCounter cntr(&dsp, true, false);
+
+	const char* const strVals[]{"12.34", "GabY", "-1.2.", "A.b.C.d."};
+	runBench("print_str", [&](uint32_t i){ dsp.print(strVals[i & 0x03]); });
+	runBench("print_int", [&](uint32_t i){ dsp.print(int32_t(i % 1999) - 999); });
+	runBench("print_int_rgt_zero", [&](uint32_t i){ dsp.print(int32_t(i % 1999) - 999, true, true); });
+	runBench("print_double", [&](uint32_t i){ dsp.print((double(i % 1999) - 999.0) / 100.0, 2); });
+	runBench("print_double_rgt_zero", [&](uint32_t i){ dsp.print((double(i % 1999) - 999.0) / 100.0, 2, true, true); });
+	runBench("print_fixed", [&](uint32_t i){ dsp.printFixed(int32_t(i % 1999) - 999, 2); });
+	runBench("gauge_int", [&](uint32_t i){ dsp.gauge(int(i & 0x03), 'b'); });
+	runBench("gauge_double", [&](uint32_t i){ dsp.gauge(double(i & 0x03) / 4.0, 'b'); });
+	runBench("double_gauge", [&](uint32_t i){ dsp.doubleGauge(int(i & 0x03), int((i >> 2) & 0x03), 'L', 'r'); });
+	runBench("write_segments", [&](uint32_t i){ dsp.write(uint8_t(i), uint8_t(i & 0x03)); });
+	runBench("write_char", [&](uint32_t i){ dsp.write(std::string("-"), uint8_t(i & 0x03)); });
+
+	dsp.print("8888");
+	dsp.blink(100, 100);
+	runBench("upd_blink_state", [&](uint32_t i){
+		if((i & 0x3F) == 0)
+			hostSimRunMs(1);
+		dsp.benchUpdBlinkState();
+	});
+	runBench("blink_1ms_virtual", [&](uint32_t i){ hostSimRunMs(1); });
+	runBench("print_int_on_blink", [&](uint32_t i){ dsp.print(int32_t(i % 1999) - 999); });
+	runBench("write_segments_on_blink", [&](uint32_t i){ dsp.write(uint8_t(i), uint8_t(i & 0x03)); });
+	dsp.noBlink();
+	runBench("blink_start_stop", [&](uint32_t i){
+		dsp.blink();
+		dsp.noBlink();
+	});
+
+	dsp.wait(100);
+	runBench("upd_wait_state", [&](uint32_t i){
+		if((i & 0x3F) == 0)
+			hostSimRunMs(1);
+		dsp.benchUpdWaitState();
+	});
+	runBench("wait_1ms_virtual", [&](uint32_t i){ hostSimRunMs(1); });
+	dsp.noWait();
+
+	dsp.print("8.8.8.8.");
+	runBench("hc595_refresh_slot", [&](uint32_t i){ dspHw.benchRefreshSlot(i & 0x03); });
+
+	TIM_HandleTypeDef rfrshTmr{};
+	rfrshTmr.Instance = TIM10;
+	dspHw.begin(rfrshTmr, 250);
+	runBench("hc595_isr_dgt_1ms_virtual", [&](uint32_t i){ hostSimRunMs(1); });	//4 digit interrupts per virtual ms
+	dspHw.end();
+	dspHw.setBrghtnssBits(3);
+	dspHw.setBrghtnss(5);
+	dspHw.begin(rfrshTmr, 250);
+	runBench("hc595_isr_bcm_1ms_virtual", [&](uint32_t i){ hostSimRunMs(1); });	//3 brightness slots per digit
+	dspHw.end();
+	dspHw.setBrghtnssBits(0);
+
+	gpioPinId_t chnPins[]{{GPIOA, GPIO_PIN_8}, {GPIOA, GPIO_PIN_9}, {GPIOA, GPIO_PIN_10}};
+	BenchDynHC595Chain chnDspHw(chnPins, 16, true, 2);
+	BenchDisplay chnDsp(&chnDspHw);
+	chnDsp.print("8.8.8.8.8.8.8.8.8.8.8.8.8.8.8.8.");
+	runBench("hc595_chain_2x8_refresh_slot", [&](uint32_t i){ chnDspHw.benchRefreshSlot(i & 0x07); });	//16 digits in 8 slots, 2 digits per slot
+
+	dspHw.begin(1);
+	chnDspHw.begin(1);
+	runBench("dyn_dspch_2_dsps_1ms_virtual", [&](uint32_t i){ hostSimRunMs(1); });	//A digit slot of each display per virtual ms
+	chnDspHw.end();
+	dspHw.end();
+
+	SPI_HandleTypeDef spiHndl{};
+	spiHndl.Instance = SPI1;
+	spiHndl.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8;
+	HAL_SPI_Init(&spiHndl);
+	BenchDynHC595Spi spiDspHw(&spiHndl, {GPIOB, GPIO_PIN_6}, 4, true);
+	BenchDisplay spiDsp(&spiDspHw);
+	spiDsp.print("8.8.8.8.");
+	runBench("hc595_spi_refresh_slot", [&](uint32_t i){	//Includes the virtual clock advance to complete the DMA transmission
+		spiDspHw.benchRefreshSlot(i & 0x03);
+		hostSimRunNs(8000);
+	});
+
+	gpioPinId_t tmPins[]{{GPIOC, GPIO_PIN_0}, {GPIOC, GPIO_PIN_1}};
+	BenchTM163X tmHw(tmPins, 16);
+	uint8_t tmDspBuff[16]{};
+	tmHw.setDspBuffPtr(tmDspBuff);
+	tmHw.dspBffrCntntChng();
+	runBench("tm163x_mssg_last_dgt", [&](uint32_t i){ tmHw.benchBldMssg(0x0001); });
+	runBench("tm163x_mssg_all_dgts", [&](uint32_t i){ tmHw.benchBldMssg(0xFFFF); });
+
+	cntr.countRestart(0);
+	runBench("counter_count_up", [&](uint32_t i){
+		if(!cntr.countUp())
+			cntr.countRestart(-999);
+	});
+
+	return 0;
+}
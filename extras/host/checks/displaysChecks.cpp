@@ -0,0 +1,423 @@
+/**
+  ******************************************************************************
+  * @file	: displaysChecks.cpp
+  * @brief	: Host checks of the SevenSegDisplays logical displays
+  *
+  * @details The display's data buffer contents are read through the underlying hardware display, the glyphs being in the font encoding (a segment is lit when it's bit is reset) whatever the display polarity.
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "sevenSegDisplays.h"
+#include "sevenSegDispHw.h"
+#include "hostStandIn.h"
+#include "hostChecks.h"
+
+//--------------------------------------------------------------- Font encoding
+struct glyph_t{
+	char chr;
+	uint8_t glyph;
+};
+
+// Displayable characters and their glyphs in the font encoding
+const glyph_t fontGlyphs[]{
+	{'0', 0xC0}, {'1', 0xF9}, {'2', 0xA4}, {'3', 0xB0}, {'4', 0x99}, {'5', 0x92}, {'6', 0x82}, {'7', 0xF8}, {'8', 0x80}, {'9', 0x90},
+	{'A', 0x88}, {'a', 0xA0}, {'b', 0x83}, {'C', 0xC6}, {'c', 0xA7}, {'d', 0xA1}, {'E', 0x86}, {'e', 0x84}, {'F', 0x8E}, {'G', 0xC2},
+	{'H', 0x89}, {'h', 0x8B}, {'I', 0xF9}, {'i', 0xFB}, {'J', 0xF1}, {'L', 0xC7}, {'l', 0xCF}, {'n', 0xAB}, {'O', 0xC0}, {'o', 0xA3},
+	{'P', 0x8C}, {'q', 0x98}, {'r', 0xAF}, {'S', 0x92}, {'t', 0x87}, {'U', 0xC1}, {'u', 0xE3}, {'Y', 0x91},
+	{'-', 0xBF}, {'_', 0xF7}, {'=', 0xB7}, {'~', 0xB6}, {'*', 0x9C}, {' ', 0xFF}
+};
+
+static int16_t glyphOf(const char &chr){
+	int16_t glyph{-1};
+
+	for(const glyph_t &fontGlyph : fontGlyphs){
+		if(fontGlyph.chr == chr){
+			glyph = fontGlyph.glyph;
+			break;
+		}
+	}
+
+	return glyph;
+}
+
+// The display's data buffer holds the text glyphs, a '.' lighting the dot of the preceding character
+static bool bffrIs(SevenSegDispHw &hw, const char* text){
+	uint8_t expctd[MAX_DIGITS_PER_DISPLAY]{};
+	uint8_t glyphsQty{0};
+	bool bffrOk{true};
+
+	for(const char* chrPtr{text}; *chrPtr && bffrOk; ++chrPtr){
+		if((*chrPtr == '.') && glyphsQty)
+			expctd[glyphsQty - 1] &= 0x7F;
+		else if((glyphOf(*chrPtr) >= 0) && (glyphsQty < MAX_DIGITS_PER_DISPLAY))
+			expctd[glyphsQty++] = uint8_t(glyphOf(*chrPtr));
+		else
+			bffrOk = false;
+	}
+	bffrOk = bffrOk && (glyphsQty == hw.getDspDigits()) && (hw.getDspBuffPtr() != nullptr);
+	for(uint8_t i{0}; bffrOk && (i < glyphsQty); ++i)	// The buffer position 0 is the display's rightmost digit
+		bffrOk = hw.getDspBuffPtr()[i] == expctd[(glyphsQty - 1) - i];
+
+	return bffrOk;
+}
+
+//--------------------------------------------------------------- print(int32_t) reference model
+// The string based implementation print(int32_t) had before rendering to a stack frame, displaying it's text through print(std::string)
+static bool refPrint(SevenSegDisplays &refDsp, const int32_t &value, bool rgtAlgn, bool zeroPad){
+	const uint8_t dgtsQty{refDsp.getDigitsQty()};
+	int32_t valMin{0};
+	int32_t valMax{1};
+	std::string readOut{""};
+	bool displayable{false};
+
+	for(uint8_t i{0}; i < dgtsQty; ++i)
+		valMax *= 10;
+	--valMax;
+	if(dgtsQty > 1)
+		valMin = -(valMax / 10);
+	if((value < valMin) || (value > valMax)){
+		refDsp.clear();
+	}
+	else{
+		readOut = std::to_string((value < 0)? -value : value);
+		if(rgtAlgn){
+			readOut = std::string(dgtsQty, zeroPad? '0' : ' ') + readOut;
+			readOut = readOut.substr(readOut.length() - ((value >= 0)? dgtsQty : (dgtsQty - 1)));
+		}
+		if(value < 0)
+			readOut = "-" + readOut;
+		displayable = refDsp.print(readOut);
+	}
+
+	return displayable;
+}
+
+//--------------------------------------------------------------- Notifications inspection
+struct blinkEdge_t{
+	TickType_t tck;	// Tick count when the display buffer changed
+	bool shown;	// The display's leftmost digit is shown after the change
+	bool operator==(const blinkEdge_t &other) const{ return (tck == other.tck) && (shown == other.shown); }
+};
+
+class CheckDynHC595: public SevenSegDynHC595{
+public:
+	uint32_t ntfctnsCnt{0};
+	uint32_t ntfctnsSchdlrRnng{0};	// Notifications received with the scheduler running
+	std::vector<blinkEdge_t> edges{};
+
+	CheckDynHC595(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode): SevenSegDynHC595(ioPins, dspDigits, commAnode){}
+	using SevenSegDynHC595::dspBffrCntntChng;
+	virtual void dspBffrCntntChng(const uint16_t &chngdDgtsMsk){
+		++ntfctnsCnt;
+		if(!hostSimSchdlrSspndLvl())
+			++ntfctnsSchdlrRnng;
+		edges.push_back({xTaskGetTickCount(), getDspBuffPtr()[getDspDigits() - 1] != 0xFF});
+		SevenSegDynHC595::dspBffrCntntChng(chngdDgtsMsk);
+	}
+};
+
+// The blinking edges expected from blink(onRate, offRate) invoked at strtTck, each stage ending exactly it's rate after the previous edge, up to endTck
+static std::vector<blinkEdge_t> blinkEdges(TickType_t strtTck, const TickType_t &endTck, const TickType_t &onRate, const TickType_t &offRate){
+	std::vector<blinkEdge_t> expctd{};
+	bool shown{true};
+
+	for(strtTck += onRate; strtTck <= endTck; strtTck += (shown? onRate : offRate)){
+		shown = !shown;
+		expctd.push_back({strtTck, shown});
+	}
+
+	return expctd;
+}
+
+//--------------------------------------------------------------- Checks
+static void checkDspDigitsMax(){
+	gpioPinId_t hcPins[]{{GPIOA, GPIO_PIN_0}, {GPIOA, GPIO_PIN_1}, {GPIOA, GPIO_PIN_2}};
+
+	// A display of MAX_DIGITS_PER_DISPLAY digits is built
+	{
+		SevenSegDynHC595 hcHw(hcPins, MAX_DIGITS_PER_DISPLAY, true);
+		SevenSegDisplays hcDsp(&hcHw);
+
+		HOST_CHECK(hcDsp.getDigitsQty() == MAX_DIGITS_PER_DISPLAY);
+		HOST_CHECK(hcHw.getDspBuffPtr() != nullptr);
+		HOST_CHECK(hcDsp.print("1234567890123456"));
+	}
+
+	// A longer display is left unbuilt, and every print is rejected
+	{
+		SevenSegDynHC595 hcHw(hcPins, 20, true);
+		SevenSegDisplays hcDsp(&hcHw);
+
+		HOST_CHECK(hcDsp.getDigitsQty() == 0);
+		HOST_CHECK(hcHw.getDspBuffPtr() == nullptr);
+		HOST_CHECK(!hcDsp.print("12345678901234567890"));
+		HOST_CHECK(!hcDsp.print(int32_t(1234)));
+		HOST_CHECK(!hcDsp.print(12.34, 2));
+	}
+
+	return;
+}
+
+static void checkFont(){
+	gpioPinId_t hcPins[]{{GPIOA, GPIO_PIN_0}, {GPIOA, GPIO_PIN_1}, {GPIOA, GPIO_PIN_2}};
+	SevenSegDynHC595 hcHw(hcPins, 4, true);
+	SevenSegDisplays hcDsp(&hcHw);
+	bool glyphsOk{true};
+
+	// Every displayable character is translated to it's glyph, a single character text being shown in the leftmost digit
+	for(const glyph_t &fontGlyph : fontGlyphs)
+		glyphsOk = glyphsOk && hcDsp.print(std::string(1, fontGlyph.chr)) && (hcHw.getDspBuffPtr()[3] == fontGlyph.glyph);
+	HOST_CHECK(glyphsOk);
+
+	// Any other character is rejected, and the display is cleared
+	glyphsOk = true;
+	for(int chr{0}; chr < 256; ++chr){
+		if((chr != '.') && (glyphOf(char(chr)) < 0)){
+			hcDsp.print("8888");
+			glyphsOk = glyphsOk && !hcDsp.print(std::string(1, char(chr))) && bffrIs(hcHw, "    ");
+		}
+	}
+	HOST_CHECK(glyphsOk);
+
+	// The dots are added to the preceding character, or shown alone over a space
+	HOST_CHECK(hcDsp.print("1.2.3.4."));
+	HOST_CHECK(bffrIs(hcHw, "1.2.3.4."));
+	HOST_CHECK(hcDsp.print(".1..2"));
+	HOST_CHECK(bffrIs(hcHw, " .1. .2"));
+	HOST_CHECK(!hcDsp.print("12345"));
+
+	return;
+}
+
+static void checkPrintFixed(){
+	gpioPinId_t hcPins[]{{GPIOA, GPIO_PIN_0}, {GPIOA, GPIO_PIN_1}, {GPIOA, GPIO_PIN_2}};
+	SevenSegDynHC595 hcHw(hcPins, 4, true);
+	SevenSegDisplays hcDsp(&hcHw);
+
+	// The decimal part leading zeros are kept
+	HOST_CHECK(hcDsp.print(1.05, 2));
+	HOST_CHECK(bffrIs(hcHw, "1.05 "));
+	HOST_CHECK(hcDsp.print(1.05, 2, true));
+	HOST_CHECK(bffrIs(hcHw, " 1.05"));
+	HOST_CHECK(hcDsp.print(-0.05, 2));
+	HOST_CHECK(bffrIs(hcHw, "-0.05"));
+	HOST_CHECK(hcDsp.print(0.5, 3));
+	HOST_CHECK(bffrIs(hcHw, "0.500"));
+
+	// The value is rounded half away from zero, the carry adding an integer part digit when it fits
+	HOST_CHECK(hcDsp.print(9.995, 2));	// Held as 9.99499..., the nearest double, so rounded down
+	HOST_CHECK(bffrIs(hcHw, "9.99 "));
+	HOST_CHECK(hcDsp.print(9.9951, 2));
+	HOST_CHECK(bffrIs(hcHw, "10.00"));
+	HOST_CHECK(hcDsp.print(-9.96, 1));
+	HOST_CHECK(bffrIs(hcHw, "-10.0"));
+	HOST_CHECK(hcDsp.print(2.345, 0, true));
+	HOST_CHECK(bffrIs(hcHw, "   2"));
+	HOST_CHECK(!hcDsp.print(99.996, 2));
+	HOST_CHECK(!hcDsp.print(-99.95, 1));
+
+	// The zero padding fills the gap between the sign and the first digit
+	HOST_CHECK(hcDsp.print(-1.5, 1, true, true));
+	HOST_CHECK(bffrIs(hcHw, "-01.5"));
+	HOST_CHECK(hcDsp.print(-1.5, 1, true, false));
+	HOST_CHECK(bffrIs(hcHw, "- 1.5"));
+	HOST_CHECK(hcDsp.printFixed(5, 1, true, true));
+	HOST_CHECK(bffrIs(hcHw, "000.5"));
+	HOST_CHECK(hcDsp.printFixed(-5, 1, true, true));
+	HOST_CHECK(bffrIs(hcHw, "-00.5"));
+	HOST_CHECK(hcDsp.printFixed(-5, 1, false, true));	// Zero padding applies to right aligned values only
+	HOST_CHECK(bffrIs(hcHw, "-0.5 "));
+
+	// The sign, at least one integer part digit and the decimal places must fit the display
+	HOST_CHECK(hcDsp.printFixed(5, 3));
+	HOST_CHECK(bffrIs(hcHw, "0.005"));
+	HOST_CHECK(!hcDsp.printFixed(-5, 3));
+	HOST_CHECK(bffrIs(hcHw, "    "));
+	HOST_CHECK(hcDsp.printFixed(-999, 0));
+	HOST_CHECK(bffrIs(hcHw, "-999"));
+	HOST_CHECK(!hcDsp.printFixed(-1000, 0));
+	HOST_CHECK(!hcDsp.printFixed(12345, 1));
+	HOST_CHECK(!hcDsp.printFixed(1, 4));
+	HOST_CHECK(!hcDsp.printFixed(INT32_MIN, 0));
+
+	// Overflowing and not a number values are rejected, and the display is cleared
+	HOST_CHECK(hcDsp.print(9999.4, 0));
+	HOST_CHECK(bffrIs(hcHw, "9999"));
+	HOST_CHECK(!hcDsp.print(9999.5, 0));
+	HOST_CHECK(bffrIs(hcHw, "    "));
+	HOST_CHECK(!hcDsp.print(3.0e9, 0));
+	HOST_CHECK(!hcDsp.print(-3.0e9, 0));
+	HOST_CHECK(!hcDsp.print(1.0e300, 2));
+	hcDsp.print("8888");
+	HOST_CHECK(!hcDsp.print(std::nan(""), 1));
+	HOST_CHECK(bffrIs(hcHw, "    "));
+	HOST_CHECK(!hcDsp.print(-std::numeric_limits<double>::infinity(), 0));
+	HOST_CHECK(!hcDsp.print(1.0, 5));
+
+	return;
+}
+
+static void checkPrintInt(){
+	gpioPinId_t hcPins[]{{GPIOA, GPIO_PIN_0}, {GPIOA, GPIO_PIN_1}, {GPIOA, GPIO_PIN_2}};
+	std::vector<int32_t> values{INT32_MIN, INT32_MIN + 1, INT32_MAX};
+	bool boundsOk{true};
+	bool rsltsOk{true};
+	bool bffrsOk{true};
+
+	for(int32_t value{-1100}; value <= 1100; ++value)
+		values.push_back(value);
+	for(int32_t pow10{10000}; pow10 <= 1000000000; pow10 *= 10){	// Each digits quantity limits, and a value with mixed digits
+		for(int32_t value : {pow10 - 1, pow10, pow10 + 1, 1234567890 % pow10})
+			values.insert(values.end(), {value, -value});
+	}
+
+	// print(int32_t) renders every alignment and padding combination as the string based implementation did, for 1 to 8 digits displays
+	for(uint8_t dgtsQty{1}; dgtsQty <= 8; ++dgtsQty){
+		SevenSegDynHC595 hcHw(hcPins, dgtsQty, true);
+		SevenSegDynHC595 refHw(hcPins, dgtsQty, true);
+		SevenSegDisplays hcDsp(&hcHw);
+		SevenSegDisplays refDsp(&refHw);
+		int32_t valMax{1};
+
+		for(uint8_t i{0}; i < dgtsQty; ++i)
+			valMax *= 10;
+		--valMax;
+		boundsOk = boundsOk && (hcDsp.getDspValMax() == valMax) && (hcDsp.getDspValMin() == ((dgtsQty > 1)? -(valMax / 10) : 0));
+		for(int32_t value : values){
+			for(uint8_t algnPad{0}; algnPad < 4; ++algnPad){
+				bool rgtAlgn{(algnPad & 0x01) != 0};
+				bool zeroPad{(algnPad & 0x02) != 0};
+
+				hcDsp.print("8");
+				refDsp.print("8");
+				rsltsOk = rsltsOk && (hcDsp.print(value, rgtAlgn, zeroPad) == refPrint(refDsp, value, rgtAlgn, zeroPad));
+				for(uint8_t i{0}; i < dgtsQty; ++i)
+					bffrsOk = bffrsOk && (hcHw.getDspBuffPtr()[i] == refHw.getDspBuffPtr()[i]);
+			}
+		}
+	}
+	HOST_CHECK(boundsOk);
+	HOST_CHECK(rsltsOk);
+	HOST_CHECK(bffrsOk);
+
+	return;
+}
+
+static void checkAnimSchdlrSspndd(){
+	gpioPinId_t hcPins[]{{GPIOA, GPIO_PIN_4}, {GPIOA, GPIO_PIN_5}, {GPIOA, GPIO_PIN_6}};
+	CheckDynHC595 blinkHw(hcPins, 4, true);
+	CheckDynHC595 waitHw(hcPins, 4, true);
+	SevenSegDisplays blinkDsp(&blinkHw);
+	SevenSegDisplays waitDsp(&waitHw);
+
+	// The animation timer updates the displays with the scheduler suspended, so no task destroys them meanwhile
+	blinkDsp.print("1234");
+	waitDsp.print("5678");
+	blinkHw.ntfctnsCnt = blinkHw.ntfctnsSchdlrRnng = 0;
+	waitHw.ntfctnsCnt = waitHw.ntfctnsSchdlrRnng = 0;
+	HOST_CHECK(blinkDsp.blink(200, 200));
+	HOST_CHECK(waitDsp.wait(100));
+	hostSimRunMs(1000);
+	HOST_CHECK(blinkHw.ntfctnsCnt >= 4);
+	HOST_CHECK(waitHw.ntfctnsCnt >= 4);
+	HOST_CHECK(blinkHw.ntfctnsSchdlrRnng == 0);
+	HOST_CHECK(waitHw.ntfctnsSchdlrRnng == 0);
+	HOST_CHECK(hostSimSchdlrSspndLvl() == 0);
+	HOST_CHECK(blinkDsp.noBlink());
+	HOST_CHECK(waitDsp.noWait());
+
+	return;
+}
+
+static void checkBlinkTiming(){
+	gpioPinId_t hcPins[]{{GPIOA, GPIO_PIN_4}, {GPIOA, GPIO_PIN_5}, {GPIOA, GPIO_PIN_6}};
+	CheckDynHC595 fstHw(hcPins, 4, true);
+	CheckDynHC595 sndHw(hcPins, 4, true);
+	SevenSegDisplays fstDsp(&fstHw);
+	SevenSegDisplays sndDsp(&sndHw);
+	TickType_t fstStrtTck{};
+	TickType_t sndStrtTck{};
+	TickType_t endTck{};
+	std::vector<blinkEdge_t> fstExpctd{};
+	std::vector<blinkEdge_t> sndExpctd{};
+	std::vector<TickType_t> edgesTcks{};
+	uint32_t cbsStrt{};
+
+	// Two displays blinking at coprime rates, started out of phase: each edge happens exactly at it's stage end, the stages alternating their rates
+	fstDsp.print("1234");
+	sndDsp.print("5678");
+	fstHw.edges.clear();
+	sndHw.edges.clear();
+	cbsStrt = hostSimTmrCbsCount();
+	fstStrtTck = xTaskGetTickCount();
+	HOST_CHECK(fstDsp.blink(101, 1999));
+	hostSimRunMs(37);
+	sndStrtTck = xTaskGetTickCount();
+	HOST_CHECK(sndDsp.blink(1999, 101));
+	hostSimRunMs(12000);
+	endTck = xTaskGetTickCount();
+	fstExpctd = blinkEdges(fstStrtTck, endTck, 101, 1999);
+	sndExpctd = blinkEdges(sndStrtTck, endTck, 1999, 101);
+	HOST_CHECK(fstExpctd.size() == 11);
+	HOST_CHECK(fstHw.edges == fstExpctd);
+	HOST_CHECK(sndHw.edges == sndExpctd);
+
+	// The timer is reprogrammed to the earliest edge pending, expiring only when an edge is due
+	for(const std::vector<blinkEdge_t>* edgesPtr : {&fstExpctd, &sndExpctd}){
+		for(const blinkEdge_t &edge : *edgesPtr){
+			if(std::find(edgesTcks.begin(), edgesTcks.end(), edge.tck) == edgesTcks.end())
+				edgesTcks.push_back(edge.tck);
+		}
+	}
+	HOST_CHECK(hostSimTmrCbsCount() - cbsStrt == edgesTcks.size());
+
+	// With no display blinking, the timer stops at it's next expiration
+	HOST_CHECK(fstDsp.noBlink());
+	HOST_CHECK(sndDsp.noBlink());
+	cbsStrt = hostSimTmrCbsCount();
+	hostSimRunMs(5000);
+	HOST_CHECK(hostSimTmrCbsCount() - cbsStrt <= 1);
+
+	// An expiration delayed past the next stage end switches a single stage, and resynchronizes the next edge to the late one, with no burst of updates
+	fstHw.edges.clear();
+	cbsStrt = hostSimTmrCbsCount();
+	fstStrtTck = xTaskGetTickCount();
+	HOST_CHECK(fstDsp.blink(200, 300));
+	hostSimRunMs(250);
+	hostSimSetTmrDaemonBlocked(true);
+	hostSimRunMs(749);
+	hostSimSetTmrDaemonBlocked(false);
+	hostSimRunMs(250);
+	HOST_CHECK(fstHw.edges == std::vector<blinkEdge_t>({{fstStrtTck + 200, false}, {fstStrtTck + 1000, true}, {fstStrtTck + 1200, false}}));
+	HOST_CHECK(hostSimTmrCbsCount() - cbsStrt == 3);
+
+	// The new rates take effect from the next stage
+	HOST_CHECK(fstDsp.setBlinkRate(150, 400));
+	hostSimRunMs(900);
+	HOST_CHECK(fstHw.edges == std::vector<blinkEdge_t>({{fstStrtTck + 200, false}, {fstStrtTck + 1000, true}, {fstStrtTck + 1200, false}, {fstStrtTck + 1500, true}, {fstStrtTck + 1650, false}, {fstStrtTck + 2050, true}}));
+	HOST_CHECK(fstDsp.noBlink());
+
+	return;
+}
+
+int main(){
+
+	hostSimReset();
+	checkDspDigitsMax();
+	checkFont();
+	checkPrintFixed();
+	checkPrintInt();
+	checkAnimSchdlrSspndd();
+	checkBlinkTiming();
+
+	return hostChecksResult("displaysChecks");
+}
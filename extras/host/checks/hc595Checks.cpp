@@ -0,0 +1,412 @@
+/**
+  ******************************************************************************
+  * @file	: hc595Checks.cpp
+  * @brief	: Host checks of the 74HC595 shift registers displays output
+  *
+  * @details The bytes shifted into the 74HC595 registers are decoded from the stand-in GPIO transitions log, as a logic analyzer would: each SCLK rising edge shifts in the DIO level, MSB first, and each RCLK rising edge latches the bytes shifted in since the previous one.
+  *
+  * The SevenSegDynHC595Chain slots port selection bytes, the SevenSegDynHC595Spi displays registration limit, the refresh dispatcher periods, and the hardware timer refresh period with different bus clocks and it's range, are checked too.
+  *
+  * The checks are built twice, against the library built with SEVENSEG_FAST_GPIO=0 (HAL_GPIO_WritePin() calls) and with SEVENSEG_FAST_GPIO=1 (direct BSRR register writes, through the stand-in register shim), so both output paths are checked against the same expected bytes and latch sequence, with DIO and SCLK on the same GPIO port and on different ones.
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#include <initializer_list>
+#include <vector>
+
+#include "sevenSegDisplays.h"
+#include "sevenSegDispHw.h"
+#include "hostStandIn.h"
+#include "hostChecks.h"
+
+//--------------------------------------------------------------- 74HC595 wire decoding
+class Hc595Decoder{
+	gpioPinId_t _sclk;
+	gpioPinId_t _rclk;
+	gpioPinId_t _dio;
+	bool _sclkLvl;
+	bool _rclkLvl;
+	bool _dioLvl;
+	std::vector<uint8_t> _shftd{};
+	uint8_t _bitCnt{0};
+public:
+	std::vector<std::vector<uint8_t>> ltchs{};	// Bytes shifted in before each latch, in shifting order
+	std::vector<uint64_t> ltchsNs{};	// Timestamp of each latch
+	uint32_t partialBytes{0};	// Latches taken with a byte partially shifted in
+
+	Hc595Decoder(const gpioPinId_t &sclk, const gpioPinId_t &rclk, const gpioPinId_t &dio)
+	:_sclk{sclk}, _rclk{rclk}, _dio{dio}, _sclkLvl{(sclk.portId->ODR & sclk.pinNum) != 0}, _rclkLvl{(rclk.portId->ODR & rclk.pinNum) != 0}, _dioLvl{(dio.portId->ODR & dio.pinNum) != 0}
+	{}
+	void feed(const hostPinTrnstn_t &trnstn){
+		if((trnstn.portId == _dio.portId) && (trnstn.pinNum == _dio.pinNum)){
+			_dioLvl = trnstn.level;
+		}
+		else if((trnstn.portId == _sclk.portId) && (trnstn.pinNum == _sclk.pinNum)){
+			if(trnstn.level && !_sclkLvl){
+				if(!_bitCnt)
+					_shftd.push_back(0);
+				_shftd.back() = uint8_t((_shftd.back() << 1) | (_dioLvl? 1 : 0));
+				_bitCnt = (_bitCnt + 1) & 0x07;
+			}
+			_sclkLvl = trnstn.level;
+		}
+		else if((trnstn.portId == _rclk.portId) && (trnstn.pinNum == _rclk.pinNum)){
+			if(trnstn.level && !_rclkLvl){
+				if(_bitCnt)
+					++partialBytes;
+				ltchs.push_back(_shftd);
+				ltchsNs.push_back(trnstn.tmStmpNs);
+				_shftd.clear();
+				_bitCnt = 0;
+			}
+			_rclkLvl = trnstn.level;
+		}
+
+		return;
+	}
+	bool lineIdle(){
+
+		return !_sclkLvl && _rclkLvl;
+	}
+};
+
+static void decode(uint32_t &trnstnsSeen, Hc595Decoder &decoder){
+	hostPinTrnstn_t trnstn{};
+
+	for(; trnstnsSeen < hostSimTrnstnsCount(); ++trnstnsSeen){
+		if(hostSimGetTrnstn(trnstnsSeen, trnstn))
+			decoder.feed(trnstn);
+	}
+
+	return;
+}
+
+static bool ltchIs(const Hc595Decoder &decoder, const size_t &ltchNum, std::initializer_list<uint8_t> bytes){
+
+	return (ltchNum < decoder.ltchs.size()) && (decoder.ltchs[ltchNum] == std::vector<uint8_t>(bytes));
+}
+
+static uint32_t pinSpeed(const gpioPinId_t &pin){
+	uint8_t pinPos{0};
+
+	while((pinPos < 15) && !(pin.pinNum & (1U << pinPos)))
+		++pinPos;
+
+	return (pin.portId->OSPEEDR >> (pinPos * 2)) & 0x03U;
+}
+
+static bool ltchsPrdIs(const Hc595Decoder &decoder, const uint64_t &prdNs){
+	bool prdsOk{decoder.ltchsNs.size() > 1};
+
+	for(size_t i{1}; i < decoder.ltchsNs.size(); ++i)
+		prdsOk = prdsOk && ((decoder.ltchsNs[i] - decoder.ltchsNs[i - 1]) == prdNs);
+
+	return prdsOk;
+}
+
+//--------------------------------------------------------------- Protected members access
+class CheckDynHC595: public SevenSegDynHC595{
+public:
+	uint32_t slotsSchdlrRnng{0};	// Slots refreshed with the scheduler running
+
+	CheckDynHC595(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode): SevenSegDynHC595(ioPins, dspDigits, commAnode){}
+	void checkRefreshSlot(const uint8_t &slot){ refreshSlot(slot, 0); }
+	virtual void refreshSlot(const uint8_t &slot, const uint8_t &bcmBitMsk){
+		if(!hostSimSchdlrSspndLvl())
+			++slotsSchdlrRnng;
+		SevenSegDynHC595::refreshSlot(slot, bcmBitMsk);
+	}
+};
+
+class CheckDynHC595Chain: public SevenSegDynHC595Chain{
+public:
+	CheckDynHC595Chain(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode, uint8_t chnMdls, uint8_t mdlPortBytes = 1): SevenSegDynHC595Chain(ioPins, dspDigits, commAnode, chnMdls, mdlPortBytes){}
+	void checkRefreshSlot(const uint8_t &slot){ refreshSlot(slot, 0); }
+};
+
+class CheckDynHC595Spi: public SevenSegDynHC595Spi{
+public:
+	CheckDynHC595Spi(SPI_HandleTypeDef* spiHndlPtr, const gpioPinId_t &rclk, uint8_t dspDigits, bool commAnode): SevenSegDynHC595Spi(spiHndlPtr, rclk, dspDigits, commAnode){}
+	void checkRefreshSlot(const uint8_t &slot){ refreshSlot(slot, 0); }
+};
+
+//--------------------------------------------------------------- Checks
+static void checkSend(gpioPinId_t* hcPins){
+	CheckDynHC595 hcHw(hcPins, 4, true);
+	SevenSegDisplays hcDsp(&hcHw);
+	uint32_t trnstnsSeen{hostSimTrnstnsCount()};
+	Hc595Decoder hcDec(hcPins[0], hcPins[1], hcPins[2]);
+	uint32_t gpioCallsStrt{hostSimGpioCallsCount()};
+
+	// Each send() shifts the segments and the port bytes, MSB first, and latches them
+	hcHw.send(0x00, 0x01);
+	hcHw.send(0xFF, 0x80);
+	hcHw.send(0xA5, 0x5A);
+	hcHw.send(0x3C, 0xC3);
+	decode(trnstnsSeen, hcDec);
+	HOST_CHECK(hcDec.ltchs.size() == 4);
+	HOST_CHECK(ltchIs(hcDec, 0, {0x00, 0x01}));
+	HOST_CHECK(ltchIs(hcDec, 1, {0xFF, 0x80}));
+	HOST_CHECK(ltchIs(hcDec, 2, {0xA5, 0x5A}));
+	HOST_CHECK(ltchIs(hcDec, 3, {0x3C, 0xC3}));
+	HOST_CHECK(hcDec.partialBytes == 0);
+	HOST_CHECK(hcDec.lineIdle());
+	HOST_CHECK(!SEVENSEG_FAST_GPIO || (hostSimGpioCallsCount() == gpioCallsStrt));	// The fast GPIO path doesn't use the HAL services
+	for(uint8_t i{0}; i < 3; ++i)	// The fast GPIO path needs the fast edges
+		HOST_CHECK(pinSpeed(hcPins[i]) == (SEVENSEG_FAST_GPIO? GPIO_SPEED_FREQ_HIGH : GPIO_SPEED_FREQ_LOW));
+
+	// Each refresh slot latches a digit's segments, inverted for the common anode display, with it's port bit, the slot 0 lighting the display's rightmost digit, port 0
+	hcDec.ltchs.clear();
+	hcDsp.print("1234");
+	for(uint8_t slot{0}; slot < 4; ++slot)
+		hcHw.checkRefreshSlot(slot);
+	decode(trnstnsSeen, hcDec);
+	HOST_CHECK(hcDec.ltchs.size() == 4);
+	HOST_CHECK(ltchIs(hcDec, 0, {0x99, 0x01}));
+	HOST_CHECK(ltchIs(hcDec, 1, {0xB0, 0x02}));
+	HOST_CHECK(ltchIs(hcDec, 2, {0xA4, 0x04}));
+	HOST_CHECK(ltchIs(hcDec, 3, {0xF9, 0x08}));
+	HOST_CHECK(hcDec.partialBytes == 0);
+	HOST_CHECK(hcDec.lineIdle());
+
+	return;
+}
+
+static void checkPolarity(){
+	gpioPinId_t hcPins[]{{GPIOD, GPIO_PIN_0}, {GPIOD, GPIO_PIN_1}, {GPIOD, GPIO_PIN_2}};
+	CheckDynHC595 hcHw(hcPins, 4, false);
+	SevenSegDisplays hcDsp(&hcHw);
+	uint32_t trnstnsSeen{hostSimTrnstnsCount()};
+	Hc595Decoder hcDec(hcPins[0], hcPins[1], hcPins[2]);
+
+	// The common cathode display latches the buffer glyphs inverted, a lit segment being a set bit, while the port bits keep their level
+	hcDsp.print("1.2-8");
+	for(uint8_t slot{0}; slot < 4; ++slot)
+		hcHw.checkRefreshSlot(slot);
+	decode(trnstnsSeen, hcDec);
+	HOST_CHECK(hcDec.ltchs.size() == 4);
+	HOST_CHECK(ltchIs(hcDec, 0, {0x7F, 0x01}));
+	HOST_CHECK(ltchIs(hcDec, 1, {0x40, 0x02}));
+	HOST_CHECK(ltchIs(hcDec, 2, {0x5B, 0x04}));
+	HOST_CHECK(ltchIs(hcDec, 3, {0x86, 0x08}));
+	HOST_CHECK(!hcHw.getCommAnode());
+
+	return;
+}
+
+static void checkChain(){
+	gpioPinId_t hcPins[]{{GPIOE, GPIO_PIN_0}, {GPIOE, GPIO_PIN_1}, {GPIOE, GPIO_PIN_2}};
+	uint32_t trnstnsSeen{0};
+	bool portsOk{true};
+
+	// A single module with 16 digits is driven with two port selection registers even if built with one, each refresh slot selects it's port
+	{
+		CheckDynHC595Chain chnHw(hcPins, 16, true, 1);
+		SevenSegDisplays chnDsp(&chnHw);
+		Hc595Decoder hcDec(hcPins[0], hcPins[1], hcPins[2]);
+
+		chnDsp.print("1234567890123456");
+		trnstnsSeen = hostSimTrnstnsCount();
+		for(uint8_t slot{0}; slot < 16; ++slot)
+			chnHw.checkRefreshSlot(slot);
+		decode(trnstnsSeen, hcDec);
+		HOST_CHECK(hcDec.ltchs.size() == 16);
+		for(size_t slot{0}; slot < hcDec.ltchs.size(); ++slot){
+			portsOk = portsOk && (hcDec.ltchs[slot].size() == 3) && (hcDec.ltchs[slot][1] == uint8_t((1 << slot) >> 8)) && (hcDec.ltchs[slot][2] == uint8_t(1 << slot));
+		}
+		HOST_CHECK(portsOk);
+		HOST_CHECK(ltchIs(hcDec, 0, {0x82, 0x00, 0x01}));	// The rightmost digit, '6'
+		HOST_CHECK(ltchIs(hcDec, 15, {0xF9, 0x80, 0x00}));	// The leftmost digit, '1'
+		HOST_CHECK(hcDec.partialBytes == 0);
+		HOST_CHECK(hcDec.lineIdle());
+	}
+
+	// Two modules of 8 digits each light a digit each per slot, the farthest module shifted first
+	{
+		CheckDynHC595Chain chnHw(hcPins, 16, true, 2);
+		SevenSegDisplays chnDsp(&chnHw);
+		Hc595Decoder hcDec(hcPins[0], hcPins[1], hcPins[2]);
+
+		chnDsp.print("1234567890123456");
+		trnstnsSeen = hostSimTrnstnsCount();
+		chnHw.checkRefreshSlot(0);
+		decode(trnstnsSeen, hcDec);
+		HOST_CHECK(hcDec.ltchs.size() == 1);
+		HOST_CHECK(ltchIs(hcDec, 0, {0x80, 0x01, 0x82, 0x01}));	// '8' in the second module, '6' in the first
+		HOST_CHECK(hcDec.partialBytes == 0);
+	}
+
+	// A display longer than the changed digits masks is left unbuilt
+	{
+		CheckDynHC595Chain chnHw(hcPins, 17, true, 2);
+
+		HOST_CHECK(!chnHw.begin());
+	}
+
+	return;
+}
+
+static void checkHwTmrRfrsh(TIM_TypeDef* tmrInst, const uint32_t &apb1ClkDiv, const uint32_t &apb2ClkDiv){
+	gpioPinId_t hcPins[]{{GPIOD, GPIO_PIN_0}, {GPIOD, GPIO_PIN_1}, {GPIOD, GPIO_PIN_2}};
+	CheckDynHC595 hcHw(hcPins, 4, true);
+	SevenSegDisplays hcDsp(&hcHw);
+	TIM_HandleTypeDef rfrshTmr{};
+	uint32_t trnstnsSeen{0};
+	Hc595Decoder hcDec(hcPins[0], hcPins[1], hcPins[2]);
+
+	// The refresh timer is prescaled to 1 MHz whatever the clock of the APB bus it's connected to
+	hostSimSetApbDivs(apb1ClkDiv, apb2ClkDiv);
+	rfrshTmr.Instance = tmrInst;
+	hcDsp.print("1234");
+	trnstnsSeen = hostSimTrnstnsCount();
+	HOST_CHECK(hcHw.begin(rfrshTmr, 500));
+	hostSimRunMs(10);
+	decode(trnstnsSeen, hcDec);
+	HOST_CHECK(hcDec.ltchs.size() >= 19);
+	HOST_CHECK(ltchsPrdIs(hcDec, 500000));
+	HOST_CHECK(hcHw.end());
+	hostSimSetApbDivs(RCC_HCLK_DIV2, RCC_HCLK_DIV1);
+
+	return;
+}
+
+static void checkDspchPrds(){
+	gpioPinId_t fstPins[]{{GPIOB, GPIO_PIN_8}, {GPIOB, GPIO_PIN_9}, {GPIOB, GPIO_PIN_10}};
+	gpioPinId_t slwPins[]{{GPIOC, GPIO_PIN_8}, {GPIOC, GPIO_PIN_9}, {GPIOC, GPIO_PIN_10}};
+	CheckDynHC595 fstHw(fstPins, 4, true);
+	CheckDynHC595 slwHw(slwPins, 4, true);
+	SevenSegDisplays fstDsp(&fstHw);
+	SevenSegDisplays slwDsp(&slwHw);
+	uint32_t fstTrnstnsSeen{0};
+	uint32_t slwTrnstnsSeen{0};
+	Hc595Decoder fstDec(fstPins[0], fstPins[1], fstPins[2]);
+	Hc595Decoder slwDec(slwPins[0], slwPins[1], slwPins[2]);
+
+	// Displays refreshed by the dispatcher with periods not multiple of each other keep their own period
+	fstDsp.print("1234");
+	slwDsp.print("5678");
+	fstTrnstnsSeen = slwTrnstnsSeen = hostSimTrnstnsCount();
+	HOST_CHECK(fstHw.begin(2));
+	HOST_CHECK(slwHw.begin(3));
+	hostSimRunMs(30);
+	decode(fstTrnstnsSeen, fstDec);
+	decode(slwTrnstnsSeen, slwDec);
+	HOST_CHECK(fstDec.ltchs.size() >= 14);
+	HOST_CHECK(slwDec.ltchs.size() >= 9);
+	HOST_CHECK(ltchsPrdIs(fstDec, 2000000));
+	HOST_CHECK(ltchsPrdIs(slwDec, 3000000));
+	// The dispatcher services the displays with the scheduler suspended, so no task ends or destroys them meanwhile
+	HOST_CHECK(fstHw.slotsSchdlrRnng == 0);
+	HOST_CHECK(slwHw.slotsSchdlrRnng == 0);
+	HOST_CHECK(hostSimSchdlrSspndLvl() == 0);
+	HOST_CHECK(fstHw.end());
+	HOST_CHECK(slwHw.end());
+
+	return;
+}
+
+static void checkHwTmrPrdRng(){
+	gpioPinId_t hcPins[]{{GPIOD, GPIO_PIN_4}, {GPIOD, GPIO_PIN_5}, {GPIOD, GPIO_PIN_6}};
+	CheckDynHC595 hcHw(hcPins, 4, true);
+	SevenSegDisplays hcDsp(&hcHw);
+	TIM_HandleTypeDef tmr16Bits{};
+	TIM_HandleTypeDef tmr32Bits{};
+
+	// The digit period must last at least 2 counts, and fit the timer's auto-reload register
+	tmr16Bits.Instance = TIM10;
+	tmr32Bits.Instance = TIM2;
+	HOST_CHECK(!hcHw.begin(tmr16Bits, 1));
+	HOST_CHECK(hcHw.begin(tmr16Bits, 2));
+	HOST_CHECK(hcHw.end());
+	HOST_CHECK(hcHw.begin(tmr16Bits, 65536));
+	HOST_CHECK(hcHw.end());
+	HOST_CHECK(!hcHw.begin(tmr16Bits, 65537));
+	HOST_CHECK(hcHw.begin(tmr32Bits, 65537));
+	HOST_CHECK(hcHw.end());
+
+	// With per digit brightness the brightness time unit must last at least 2 counts, and the highest bit slot fit the auto-reload register
+	HOST_CHECK(hcHw.setBrghtnssBits(7));
+	HOST_CHECK(!hcHw.begin(tmr16Bits, 200));	// 1 us time unit
+	HOST_CHECK(hcHw.begin(tmr16Bits, 254));	// 2 us time unit
+	HOST_CHECK(hcHw.end());
+	HOST_CHECK(hcHw.begin(tmr16Bits, 130048));	// 1024 us time unit, 65536 us highest bit slot
+	HOST_CHECK(hcHw.end());
+	HOST_CHECK(!hcHw.begin(tmr16Bits, 130175));	// 1025 us time unit
+	HOST_CHECK(hcHw.begin(tmr32Bits, 130175));
+	HOST_CHECK(hcHw.end());
+
+	// The brightness bits of a display being refreshed are only changed if the resulting slots fit the timer
+	HOST_CHECK(hcHw.setBrghtnssBits(3));
+	HOST_CHECK(hcHw.begin(tmr16Bits, 14));	// 2 us time unit
+	HOST_CHECK(!hcHw.setBrghtnssBits(4));	// 0 us time unit
+	HOST_CHECK(hcHw.getBrghtnssLvls() == 8);
+	HOST_CHECK(hcHw.setBrghtnssBits(0));
+	HOST_CHECK(hcHw.end());
+
+	return;
+}
+
+static void checkSpiRgstr(){
+	SPI_HandleTypeDef spiHndl{};
+	SevenSegDynHC595Spi* spiHwPtrs[5]{};
+
+	// The SPI displays beyond the transmission complete callback registration list capacity can't be started
+	spiHndl.Instance = SPI1;
+	for(uint8_t i{0}; i < 5; ++i)
+		spiHwPtrs[i] = new SevenSegDynHC595Spi(&spiHndl, {GPIOC, uint16_t(GPIO_PIN_0 << i)}, 4, true);
+	for(uint8_t i{0}; i < 4; ++i)
+		HOST_CHECK(spiHwPtrs[i]->begin());
+	HOST_CHECK(!spiHwPtrs[4]->begin());
+	for(uint8_t i{0}; i < 5; ++i)
+		delete spiHwPtrs[i];
+
+	// The registration list entries are freed by the destructor
+	spiHwPtrs[0] = new SevenSegDynHC595Spi(&spiHndl, {GPIOC, GPIO_PIN_0}, 4, true);
+	HOST_CHECK(spiHwPtrs[0]->begin());
+	delete spiHwPtrs[0];
+
+	return;
+}
+
+static void checkSpiSlot(){
+	SPI_HandleTypeDef spiHndl{};
+	spiHndl.Instance = SPI1;
+	spiHndl.State = HAL_SPI_STATE_READY;
+	CheckDynHC595Spi spiHw(&spiHndl, {GPIOC, GPIO_PIN_0}, 4, true);
+	SevenSegDisplays spiDsp(&spiHw);
+	uint32_t bytesSeen{};
+
+	// A refresh slot transmits a single digit, the digit's segments and it's position bytes
+	spiDsp.print("1234");
+	hostSimRunMs(1);
+	bytesSeen = hostSimSpiBytesCount();
+	spiHw.checkRefreshSlot(0);
+	hostSimRunMs(1);
+	HOST_CHECK(hostSimSpiBytesCount() - bytesSeen == 2);
+	HOST_CHECK(!spiHw.getSpiBusy());
+
+	return;
+}
+
+int main(){
+	gpioPinId_t samePortPins[]{{GPIOA, GPIO_PIN_0}, {GPIOA, GPIO_PIN_1}, {GPIOA, GPIO_PIN_2}};
+	gpioPinId_t splitPortsPins[]{{GPIOA, GPIO_PIN_4}, {GPIOA, GPIO_PIN_5}, {GPIOB, GPIO_PIN_0}};
+
+	hostSimReset();
+	checkSend(samePortPins);
+	checkSend(splitPortsPins);
+	checkPolarity();
+	checkChain();
+	checkSpiRgstr();
+	checkSpiSlot();
+	checkDspchPrds();
+	checkHwTmrRfrsh(TIM2, RCC_HCLK_DIV4, RCC_HCLK_DIV1);	// APB1 timer, 42 MHz kernel clock
+	checkHwTmrRfrsh(TIM10, RCC_HCLK_DIV2, RCC_HCLK_DIV2);	// APB2 timer, 84 MHz kernel clock
+	checkHwTmrRfrsh(TIM11, RCC_HCLK_DIV2, RCC_HCLK_DIV1);	// APB2 timer, 84 MHz kernel clock, undivided bus
+	checkHwTmrPrdRng();
+
+	return hostChecksResult(SEVENSEG_FAST_GPIO? "hc595ChecksFastGpio" : "hc595Checks");
+}
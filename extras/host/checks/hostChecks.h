@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file	: hostChecks.h
+  * @brief	: Minimal assertion support for the SevenSegDisplays_STM32 library host checks
+  *
+  * @details Each host check is an executable running it's checks over the host HAL/FreeRTOS stand-in layer, reporting every failed assertion on stderr and exiting with a non zero status if any failed, as expected by ctest.
+  *
+  * @note The library keeps it's timers handles in static members, and the stand-in frees all the software timers in hostSimReset(), so each check executable resets the stand-in once, before constructing any display.
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#ifndef _HOSTCHECKS_H_
+#define _HOSTCHECKS_H_
+
+#include <cstdint>
+#include <cstdio>
+
+inline uint32_t hostChecksFailed{0};
+
+inline bool hostCheck(const bool &cond, const char* condTxt, const char* fileName, const int &lineNum){
+	if(!cond){
+		std::fprintf(stderr, "%s:%d: check failed: %s\n", fileName, lineNum, condTxt);
+		++hostChecksFailed;
+	}
+
+	return cond;
+}
+
+#define HOST_CHECK(cond) hostCheck((cond), #cond, __FILE__, __LINE__)
+
+/**
+ * @brief Reports the checks result, to be returned by the check's main()
+ *
+ * @param checkName Name of the check executable.
+ *
+ * @return 0 if all the checks passed, 1 otherwise
+ */
+inline int hostChecksResult(const char* checkName){
+	if(hostChecksFailed)
+		std::fprintf(stderr, "%s: %u checks failed\n", checkName, hostChecksFailed);
+	else
+		std::printf("%s: all checks passed\n", checkName);
+
+	return hostChecksFailed? 1 : 0;
+}
+
+#endif /* _HOSTCHECKS_H_ */
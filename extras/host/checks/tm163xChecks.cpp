@@ -0,0 +1,320 @@
+/**
+  ******************************************************************************
+  * @file	: tm163xChecks.cpp
+  * @brief	: Host checks of the TM163X transmission state machine and the TM163X bus group
+  *
+  * @details The frames put on the wire are decoded from the stand-in GPIO transitions log, as a logic analyzer would, and compared with the ones expected:
+  * - Start: DIO falls while CLK is high. Stop: DIO rises while CLK is high.
+  * - Data bits: the DIO level at each CLK rising edge, LSB first, 8 per byte.
+  * - ACK: the DIO line released by the master while CLK is low after the 8th bit, and pulled low by the chip until the 9th CLK falling edge. The stand-in logs the master's output levels only, so the chip's answer is modeled by each decoder's chipAcks flag, set along with the DIO input level. A frame ended by the master before the 9th CLK rising edge, or not answered by the chip, is decoded as not acknowledged.
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#include <initializer_list>
+#include <vector>
+
+#include "sevenSegDisplays.h"
+#include "sevenSegDispHw.h"
+#include "hostStandIn.h"
+#include "hostChecks.h"
+
+const uint8_t ACK_TMOUT_TCKS{10};	// Timer interrupts the library waits for the ACK before aborting, TM163X_ACK_TMOUT_TCKS
+
+//--------------------------------------------------------------- TM163X wire decoding
+struct tmFrm_t{
+	std::vector<uint8_t> bytes;	// Bytes acknowledged by the chip
+	bool nacked{false};	// A byte of the frame was not acknowledged, the master ended the frame
+	uint64_t strtNs{0};	// Start signal timestamp
+	uint64_t ackWtNs{0};	// Longest DIO released time before the 9th CLK rising edge of a byte
+};
+
+class TmDecoder{
+	GPIO_TypeDef* _port;
+	uint16_t _clkPin;
+	uint16_t _dioPin;
+	bool _clk{true};
+	bool _dio{true};
+	bool _inFrm{false};
+	uint8_t _bitCnt{0};
+	uint8_t _cur{0};
+	uint64_t _rlsNs{0};
+public:
+	std::vector<tmFrm_t> frms{};
+	uint32_t protoErrs{0};
+	bool chipAcks{true};
+
+	TmDecoder(GPIO_TypeDef* port, const uint16_t &clkPin, const uint16_t &dioPin): _port{port}, _clkPin{clkPin}, _dioPin{dioPin}{}
+	void feed(const hostPinTrnstn_t &trnstn){
+		if(trnstn.portId != _port)
+			return;
+		if(trnstn.pinNum == _clkPin){
+			_clk = trnstn.level;
+			if(_clk && _inFrm){
+				if(_bitCnt < 8){	// Data bit, the Stop signal CLK pulse is decoded as a 0 bit starting a new byte
+					_cur |= uint8_t((_dio? 1 : 0) << _bitCnt);
+					++_bitCnt;
+				}
+				else{	// ACK slot
+					tmFrm_t &frm{frms.back()};
+					if((trnstn.tmStmpNs - _rlsNs) > frm.ackWtNs)
+						frm.ackWtNs = trnstn.tmStmpNs - _rlsNs;
+					if(_dio && chipAcks)
+						frm.bytes.push_back(_cur);
+					else
+						frm.nacked = true;	// The chip didn't answer, or the master drove DIO low for the Stop signal
+					_bitCnt = 0;
+					_cur = 0;
+				}
+			}
+		}
+		else if(trnstn.pinNum == _dioPin){
+			if(_clk){
+				if(_dio && !trnstn.level){	// Start
+					if(_inFrm)
+						++protoErrs;
+					_inFrm = true;
+					frms.push_back(tmFrm_t{});
+					frms.back().strtNs = trnstn.tmStmpNs;
+					_bitCnt = 0;
+					_cur = 0;
+				}
+				else if(!_dio && trnstn.level){	// Stop
+					if(!_inFrm || !(((_bitCnt == 1) && !_cur) || (!_bitCnt && frms.back().nacked)))
+						++protoErrs;
+					_inFrm = false;
+				}
+			}
+			else if(trnstn.level && _inFrm && (_bitCnt == 8)){	// DIO released for the ACK
+				_rlsNs = trnstn.tmStmpNs;
+			}
+			_dio = trnstn.level;
+		}
+
+		return;
+	}
+	void clear(){
+		frms.clear();
+		protoErrs = 0;
+
+		return;
+	}
+};
+
+static uint32_t trnstnsSeen{0};
+
+static void decode(std::initializer_list<TmDecoder*> decoders){
+	hostPinTrnstn_t trnstn{};
+
+	for(; trnstnsSeen < hostSimTrnstnsCount(); ++trnstnsSeen){
+		if(hostSimGetTrnstn(trnstnsSeen, trnstn)){
+			for(TmDecoder* decoderPtr : decoders)
+				decoderPtr->feed(trnstn);
+		}
+	}
+
+	return;
+}
+
+static bool frmIs(const TmDecoder &decoder, const size_t &frmNum, std::initializer_list<uint8_t> bytes){
+
+	return (frmNum < decoder.frms.size()) && !decoder.frms[frmNum].nacked && (decoder.frms[frmNum].bytes == std::vector<uint8_t>(bytes));
+}
+
+static bool pinsIdle(GPIO_TypeDef* port, const uint16_t &pinsMask){
+
+	return (port->ODR & pinsMask) == pinsMask;
+}
+
+//--------------------------------------------------------------- Checks
+static void checkSingleDisplay(TIM_HandleTypeDef &txTmr){
+	gpioPinId_t tmPins[]{{GPIOB, GPIO_PIN_0}, {GPIOB, GPIO_PIN_1}};
+	SevenSegTM163X tmHw(tmPins, 4);
+	SevenSegDisplays tmDsp(&tmHw);
+	TmDecoder tmDec(GPIOB, GPIO_PIN_0, GPIO_PIN_1);
+	uint64_t ackWtNs{0};
+
+	// begin(): the whole display RAM in auto-increment mode, followed by the display control command
+	trnstnsSeen = hostSimTrnstnsCount();
+	HOST_CHECK(tmHw.begin(txTmr));
+	HOST_CHECK(tmHw.getTxBusy());
+	hostSimRunMs(5);
+	decode({&tmDec});
+	HOST_CHECK(tmDec.frms.size() == 3);
+	HOST_CHECK(frmIs(tmDec, 0, {0x40}));
+	HOST_CHECK(frmIs(tmDec, 1, {0xC0, 0x00, 0x00, 0x00, 0x00}));
+	HOST_CHECK(frmIs(tmDec, 2, {0x88}));
+	HOST_CHECK(tmDec.protoErrs == 0);
+	HOST_CHECK(!tmHw.getTxBusy());
+	HOST_CHECK(tmHw.getTxFrmsSent() == 1);
+	HOST_CHECK(pinsIdle(GPIOB, GPIO_PIN_0 | GPIO_PIN_1));
+	ackWtNs = tmDec.frms[0].ackWtNs;
+	HOST_CHECK(ackWtNs > 0);
+
+	// All the digits changed: one address run, the bytes decoded LSB first. The display's rightmost digit is the chip's address 0
+	tmDec.clear();
+	tmDsp.print("1234");
+	hostSimRunMs(5);
+	decode({&tmDec});
+	HOST_CHECK(tmDec.frms.size() == 2);
+	HOST_CHECK(frmIs(tmDec, 0, {0x40}));
+	HOST_CHECK(frmIs(tmDec, 1, {0xC0, 0x66, 0x4F, 0x5B, 0x06}));
+	HOST_CHECK(tmDec.protoErrs == 0);
+
+	// A single digit changed: fixed address mode
+	tmDec.clear();
+	tmDsp.print("1235");
+	hostSimRunMs(5);
+	decode({&tmDec});
+	HOST_CHECK(tmDec.frms.size() == 2);
+	HOST_CHECK(frmIs(tmDec, 0, {0x44}));
+	HOST_CHECK(frmIs(tmDec, 1, {0xC0, 0x6D}));
+	HOST_CHECK(tmDec.protoErrs == 0);
+	HOST_CHECK(tmHw.getTxFrmsSent() == 3);
+
+	// The chip doesn't ACK: the first frame is ended by the timeout, the rest of the message is dropped and the bus left idle
+	tmDec.clear();
+	hostSimSetInputLevel(GPIOB, GPIO_PIN_1, GPIO_PIN_SET);
+	tmDec.chipAcks = false;
+	tmDsp.print("1236");
+	hostSimRunMs(5);
+	decode({&tmDec});
+	HOST_CHECK(tmDec.frms.size() == 1);
+	HOST_CHECK((tmDec.frms.size() == 1) && tmDec.frms[0].nacked && tmDec.frms[0].bytes.empty());
+	HOST_CHECK((tmDec.frms.size() == 1) && (tmDec.frms[0].ackWtNs >= ACK_TMOUT_TCKS * ackWtNs));
+	HOST_CHECK(tmDec.protoErrs == 0);
+	HOST_CHECK(!tmHw.getTxBusy());
+	HOST_CHECK(tmHw.getTxFrmsSent() == 3);
+	HOST_CHECK(pinsIdle(GPIOB, GPIO_PIN_0 | GPIO_PIN_1));
+
+	// After an aborted transmission the chip's RAM contents are unknown: the next one resends all the digits and the display control command
+	tmDec.clear();
+	hostSimSetInputLevel(GPIOB, GPIO_PIN_1, GPIO_PIN_RESET);
+	tmDec.chipAcks = true;
+	tmDsp.print("1237");
+	hostSimRunMs(5);
+	decode({&tmDec});
+	HOST_CHECK(tmDec.frms.size() == 3);
+	HOST_CHECK(frmIs(tmDec, 0, {0x40}));
+	HOST_CHECK(frmIs(tmDec, 1, {0xC0, 0x07, 0x4F, 0x5B, 0x06}));
+	HOST_CHECK(frmIs(tmDec, 2, {0x88}));
+	HOST_CHECK(tmDec.protoErrs == 0);
+	HOST_CHECK(tmHw.getTxFrmsSent() == 4);
+
+	tmHw.end();
+
+	return;
+}
+
+static void checkCtrlOnly(TIM_HandleTypeDef &txTmr){
+	gpioPinId_t tmPins[]{{GPIOB, GPIO_PIN_2}, {GPIOB, GPIO_PIN_3}};
+	SevenSegTM163X tmHw(tmPins, 4);
+	TmDecoder tmDec(GPIOB, GPIO_PIN_2, GPIO_PIN_3);
+
+	// No data buffer attached: begin() sends the display control command alone
+	trnstnsSeen = hostSimTrnstnsCount();
+	HOST_CHECK(tmHw.begin(txTmr));
+	hostSimRunMs(5);
+	decode({&tmDec});
+	HOST_CHECK(tmDec.frms.size() == 1);
+	HOST_CHECK(frmIs(tmDec, 0, {0x88}));
+	HOST_CHECK(tmDec.protoErrs == 0);
+	HOST_CHECK(!tmHw.getTxBusy());
+
+	tmHw.end();
+
+	return;
+}
+
+static void checkBus(TIM_HandleTypeDef &txTmr){
+	gpioPinId_t shrtPins[]{{GPIOC, GPIO_PIN_0}, {GPIOC, GPIO_PIN_1}};
+	gpioPinId_t lngPins[]{{GPIOC, GPIO_PIN_0}, {GPIOC, GPIO_PIN_2}};
+	SevenSegTM163X shrtHw(shrtPins, 4);
+	SevenSegTM163X lngHw(lngPins, 6);
+	SevenSegDisplays shrtDsp(&shrtHw);
+	SevenSegDisplays lngDsp(&lngHw);
+	SevenSegTM163XBus tmBus(shrtPins[0], GPIOC);
+	TmDecoder shrtDec(GPIOC, GPIO_PIN_0, GPIO_PIN_1);
+	TmDecoder lngDec(GPIOC, GPIO_PIN_0, GPIO_PIN_2);
+
+	HOST_CHECK(tmBus.attach(&shrtHw));
+	HOST_CHECK(tmBus.attach(&lngHw));
+	HOST_CHECK(tmBus.getDspsQty() == 2);
+	HOST_CHECK(shrtHw.begin(txTmr));
+	HOST_CHECK(lngHw.begin(txTmr));
+	hostSimRunMs(10);
+	HOST_CHECK(!shrtHw.getTxBusy() && !lngHw.getTxBusy());
+
+	// Frames posted while the group transmits are sent together in the group's next turn
+	trnstnsSeen = hostSimTrnstnsCount();
+	shrtDsp.print("0000");
+	HOST_CHECK(shrtHw.getTxBusy());
+	shrtDsp.print("1234");
+	lngDsp.print("5");
+	hostSimRunMs(10);
+	decode({&shrtDec, &lngDec});
+	HOST_CHECK(shrtDec.frms.size() == 4);
+	HOST_CHECK(frmIs(shrtDec, 0, {0x40}));
+	HOST_CHECK(frmIs(shrtDec, 1, {0xC0, 0x3F, 0x3F, 0x3F, 0x3F}));
+	HOST_CHECK(frmIs(shrtDec, 2, {0x40}));
+	HOST_CHECK(frmIs(shrtDec, 3, {0xC0, 0x66, 0x4F, 0x5B, 0x06}));
+	HOST_CHECK(lngDec.frms.size() == 2);
+	HOST_CHECK(frmIs(lngDec, 0, {0x44}));
+	HOST_CHECK(frmIs(lngDec, 1, {0xC5, 0x6D}));
+	HOST_CHECK((shrtDec.frms.size() == 4) && (lngDec.frms.size() == 2) && (shrtDec.frms[2].strtNs == lngDec.frms[0].strtNs));
+	HOST_CHECK(shrtDec.protoErrs == 0);
+	HOST_CHECK(lngDec.protoErrs == 0);
+	HOST_CHECK(!shrtHw.getTxBusy() && !lngHw.getTxBusy());
+	HOST_CHECK(pinsIdle(GPIOC, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2));
+
+	// A display not answering in the group: the shared CLK can't wait for it, it's message is aborted after the 9th CLK pulse while the other one is completed
+	shrtDec.clear();
+	lngDec.clear();
+	hostSimSetInputLevel(GPIOC, GPIO_PIN_2, GPIO_PIN_SET);
+	lngDec.chipAcks = false;
+	shrtDsp.print("1235");
+	lngDsp.print("6");
+	hostSimRunMs(10);
+	decode({&shrtDec, &lngDec});
+	HOST_CHECK(shrtDec.frms.size() == 2);
+	HOST_CHECK(frmIs(shrtDec, 0, {0x44}));
+	HOST_CHECK(frmIs(shrtDec, 1, {0xC0, 0x6D}));
+	HOST_CHECK(lngDec.frms.size() == 1);
+	HOST_CHECK((lngDec.frms.size() == 1) && lngDec.frms[0].nacked);
+	HOST_CHECK(shrtDec.protoErrs == 0);
+	HOST_CHECK(lngDec.protoErrs == 0);
+	HOST_CHECK(!shrtHw.getTxBusy() && !lngHw.getTxBusy());
+	HOST_CHECK(pinsIdle(GPIOC, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2));
+
+	// The aborted display resends all it's digits and the display control command
+	lngDec.clear();
+	hostSimSetInputLevel(GPIOC, GPIO_PIN_2, GPIO_PIN_RESET);
+	lngDec.chipAcks = true;
+	lngDsp.print("7");
+	hostSimRunMs(10);
+	decode({&shrtDec, &lngDec});
+	HOST_CHECK(lngDec.frms.size() == 3);
+	HOST_CHECK(frmIs(lngDec, 0, {0x40}));
+	HOST_CHECK(frmIs(lngDec, 1, {0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07}));
+	HOST_CHECK(frmIs(lngDec, 2, {0x88}));
+	HOST_CHECK(lngDec.protoErrs == 0);
+	HOST_CHECK(shrtDec.frms.size() == 2);
+
+	shrtHw.end();
+	lngHw.end();
+
+	return;
+}
+
+int main(){
+	TIM_HandleTypeDef txTmr{};
+
+	hostSimReset();
+	checkSingleDisplay(txTmr);
+	checkCtrlOnly(txTmr);
+	checkBus(txTmr);
+
+	return hostChecksResult("tm163xChecks");
+}
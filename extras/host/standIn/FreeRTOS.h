@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file	: FreeRTOS.h
+  * @brief	: Host stand-in for the FreeRTOS kernel main header
+  *
+  * @details Provides the FreeRTOS base types, configuration constants and macros used by the SevenSegDisplays_STM32 library, so the library sources can be compiled and run on a development host. The kernel services are emulated over a virtual clock, see hostStandIn.h
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE	((BaseType_t)0)
+#define pdTRUE		((BaseType_t)1)
+#define pdPASS		(pdTRUE)
+#define pdFAIL		(pdFALSE)
+
+#define portMAX_DELAY	((TickType_t)0xFFFFFFFFUL)
+
+#define configTICK_RATE_HZ	((TickType_t)1000)
+#define configTIMER_TASK_PRIORITY	(2)
+#define configSUPPORT_STATIC_ALLOCATION	1
+#define configSUPPORT_DYNAMIC_ALLOCATION	1
+#define configASSERT(x)	do{ if(!(x)) { for(;;){} } }while(0)
+
+typedef struct xSTATIC_TIMER{	// Opaque storage for the statically created software timers, the stand-in keeps every timer in it's own pool
+	void* pvDummy[8];
+}StaticTimer_t;
+
+#define portTICK_PERIOD_MS	((TickType_t)1000 / configTICK_RATE_HZ)
+#define portTICK_RATE_MS	portTICK_PERIOD_MS
+#define portYIELD_FROM_ISR(xSwitchRequired)	((void)(xSwitchRequired))
+#define pdMS_TO_TICKS(xTimeInMs)	((TickType_t)(((TickType_t)(xTimeInMs) * (TickType_t)configTICK_RATE_HZ) / (TickType_t)1000U))
+
+#endif	/* INC_FREERTOS_H */
@@ -0,0 +1,724 @@
+/**
+ * @file		: hostStandIn.cpp
+ * @brief	: Source file for the host HAL/FreeRTOS stand-in layer
+ *
+ * @author	: Gabriel D. Goldman
+ * @date		: Created on: 16/10/2026
+ */
+#include <stddef.h>
+#include <string.h>
+
+#include "hostStandIn.h"
+#include "task.h"
+#include "timers.h"
+
+//--------------------------------------------------------------- Stand-in peripherals
+GPIO_TypeDef hostGpioPorts[HOST_GPIO_PORTS_QTY]{};
+TIM_TypeDef hostTimInstances[HOST_TIM_QTY]{};
+SPI_TypeDef hostSpiInstances[HOST_SPI_QTY]{};
+
+//--------------------------------------------------------------- Stand-in kernel objects
+struct tmrTimerControl{
+	bool inUse;
+	char name[16];
+	TickType_t period;
+	bool autoReload;
+	void* tmrId;
+	TimerCallbackFunction_t tmrCb;
+	bool active;
+	TickType_t expiry;
+};
+
+namespace{
+	const uint8_t TMRS_POOL_LNGTH{64};
+	const uint8_t STRTD_TIMS_MAX{8};
+	const uint8_t STRTD_SPIS_MAX{HOST_SPI_QTY};
+	const uint64_t NS_PER_TICK{1000000000ULL / configTICK_RATE_HZ};
+
+	tmrTimerControl tmrsPool[TMRS_POOL_LNGTH]{};
+	TIM_HandleTypeDef* strtdTims[STRTD_TIMS_MAX]{};
+	uint64_t timsNxtEvntNs[STRTD_TIMS_MAX]{};
+	SPI_HandleTypeDef* strtdSpis[STRTD_SPIS_MAX]{};
+	uint64_t spisNxtEvntNs[STRTD_SPIS_MAX]{};
+	uint16_t spisXferPos[STRTD_SPIS_MAX]{};
+
+	uint64_t nowNs{0};
+	TickType_t tickCount{0};
+	uint16_t inputLvls[HOST_GPIO_PORTS_QTY]{};
+	hostPinTrnstn_t trnstnsLog[HOST_TRNSTN_LOG_LNGTH]{};
+	uint32_t trnstnsCount{0};
+	hostSpiByte_t spiLog[HOST_SPI_LOG_LNGTH]{};
+	uint32_t spiBytesCount{0};
+	uint32_t gpioCallsCount{0};
+	uint32_t crtclSctnsCount{0};
+	uint32_t crtclNstngLvl{0};
+	uint32_t schdlrSspndLvl{0};
+	int taskHndlDummy{0};
+	uint32_t taskNtfctnsCount{0};
+	bool tmrCmdsFail{false};
+	bool tmrDaemonBlckd{false};
+	uint32_t tmrCbsCount{0};
+	uint32_t apb1ClkDiv{RCC_HCLK_DIV2};
+	uint32_t apb2ClkDiv{RCC_HCLK_DIV1};
+
+	uint32_t apbClkHz(const uint32_t &apbClkDiv){
+		//The RCC_HCLK_DIVx values encode the prescaler in the PPRE field: 0xx undivided, 1xx divided by 2^(xx + 1)
+
+		return (apbClkDiv & 0x1000U)? (HOST_HCLK_HZ >> (((apbClkDiv >> 10) & 0x03U) + 1)) : HOST_HCLK_HZ;
+	}
+
+	uint32_t timClkHz(const TIM_TypeDef* timInst){
+		//The STM32F401 APB2 timers are TIM1, TIM9, TIM10 and TIM11, the timers kernel clock doubles the bus clock when the bus is divided
+		bool onApb2{(timInst == TIM1) || (timInst == TIM9) || (timInst == TIM10) || (timInst == TIM11)};
+		uint32_t apbClkDiv{onApb2? apb2ClkDiv : apb1ClkDiv};
+
+		return (apbClkDiv == RCC_HCLK_DIV1)? apbClkHz(apbClkDiv) : 2 * apbClkHz(apbClkDiv);
+	}
+
+	bool isOutput(GPIO_TypeDef* portId, const uint8_t &pinPos){
+
+		return ((portId->MODER >> (pinPos * 2)) & 0x03U) == 0x01U;
+	}
+
+	bool isOpenDrain(GPIO_TypeDef* portId, const uint8_t &pinPos){
+
+		return (portId->OTYPER & (1U << pinPos)) != 0;
+	}
+
+	bool pinLvl(GPIO_TypeDef* portId, const uint16_t &pinMask, const uint8_t &pinPos){
+		//Output pins read their output data register level, wired AND with the external level for the open drain ones
+		bool level{false};
+
+		if(isOutput(portId, pinPos)){
+			level = (portId->ODR & pinMask) != 0;
+			if(isOpenDrain(portId, pinPos))
+				level = level && ((inputLvls[portId - hostGpioPorts] & pinMask) != 0);
+		}
+		else
+			level = (inputLvls[portId - hostGpioPorts] & pinMask) != 0;
+
+		return level;
+	}
+
+	void logPinLvl(GPIO_TypeDef* portId, const uint16_t &pinMask, const uint8_t &level){
+		hostPinTrnstn_t* trnstnPtr{&trnstnsLog[trnstnsCount % HOST_TRNSTN_LOG_LNGTH]};
+
+		trnstnPtr->tmStmpNs = nowNs;
+		trnstnPtr->seqNum = trnstnsCount;
+		trnstnPtr->portId = portId;
+		trnstnPtr->pinNum = pinMask;
+		trnstnPtr->level = level;
+		++trnstnsCount;
+
+		return;
+	}
+
+	void setPinsLvl(GPIO_TypeDef* portId, const uint16_t &pinsMask, const bool &level){
+		for(uint8_t pos{0}; pos < 16; pos++){
+			uint16_t pinMask = uint16_t(1U << pos);
+			if(pinsMask & pinMask){
+				if(((portId->ODR & pinMask) != 0) != level){
+					if(level)
+						portId->ODR |= pinMask;
+					else
+						portId->ODR &= ~uint32_t(pinMask);
+					logPinLvl(portId, pinMask, level);
+				}
+			}
+		}
+
+		return;
+	}
+
+	uint64_t timPeriodNs(const TIM_HandleTypeDef* htim){
+		uint64_t tmrClkCycles{(uint64_t(htim->Instance->PSC) + 1) * (uint64_t(htim->Instance->ARR) + 1)};
+
+		return (tmrClkCycles * 1000000000ULL) / timClkHz(htim->Instance);
+	}
+
+	uint64_t spiByteNs(const SPI_HandleTypeDef* hspi){
+		uint64_t spiClkDiv{uint64_t(2) << ((hspi->Init.BaudRatePrescaler >> 3) & 0x07U)};
+
+		return (8 * spiClkDiv * 1000000000ULL) / HOST_SPI_CLK_HZ;
+	}
+
+	void runSpi(const uint8_t &spiPos){
+		//A byte was shifted out, the transmission complete callback is executed after the last one
+		SPI_HandleTypeDef* hspi{strtdSpis[spiPos]};
+		hostSpiByte_t* bytePtr{&spiLog[spiBytesCount % HOST_SPI_LOG_LNGTH]};
+
+		bytePtr->tmStmpNs = nowNs;
+		bytePtr->seqNum = spiBytesCount;
+		bytePtr->spiId = hspi->Instance;
+		bytePtr->data = hspi->pTxBuffPtr[spisXferPos[spiPos]];
+		hspi->Instance->DR = bytePtr->data;
+		++spiBytesCount;
+		if(++spisXferPos[spiPos] < hspi->TxXferSize){
+			spisNxtEvntNs[spiPos] += spiByteNs(hspi);
+		}
+		else{
+			strtdSpis[spiPos] = nullptr;
+			hspi->State = HAL_SPI_STATE_READY;
+			if(hspi->TxCpltCallback)
+				hspi->TxCpltCallback(hspi);
+		}
+
+		return;
+	}
+
+	void runTmrDaemon(){
+		//An expiration missed while the daemon was blocked is processed late, the auto-reload timers being reloaded from their expiry time, as FreeRTOS does
+		if(tmrDaemonBlckd)
+			return;
+		for(uint8_t i{0}; i < TMRS_POOL_LNGTH; i++){
+			tmrTimerControl* tmrPtr{&tmrsPool[i]};
+			while(tmrPtr->inUse && tmrPtr->active && (static_cast<TickType_t>(tickCount - tmrPtr->expiry) < (portMAX_DELAY >> 1))){
+				if(tmrPtr->autoReload)
+					tmrPtr->expiry += tmrPtr->period;
+				else
+					tmrPtr->active = false;
+				++tmrCbsCount;
+				tmrPtr->tmrCb(tmrPtr);
+			}
+		}
+
+		return;
+	}
+}
+
+//--------------------------------------------------------------- Stand-in control API
+
+void hostSimReset(){
+	memset(static_cast<void*>(hostGpioPorts), 0, sizeof(hostGpioPorts));
+	memset(static_cast<void*>(hostTimInstances), 0, sizeof(hostTimInstances));
+	memset(static_cast<void*>(tmrsPool), 0, sizeof(tmrsPool));
+	for(uint8_t i{0}; i < STRTD_TIMS_MAX; i++){
+		strtdTims[i] = nullptr;
+		timsNxtEvntNs[i] = 0;
+	}
+	memset(static_cast<void*>(hostSpiInstances), 0, sizeof(hostSpiInstances));
+	for(uint8_t i{0}; i < STRTD_SPIS_MAX; i++){
+		strtdSpis[i] = nullptr;
+		spisNxtEvntNs[i] = 0;
+		spisXferPos[i] = 0;
+	}
+	spiBytesCount = 0;
+	for(uint8_t i{0}; i < HOST_GPIO_PORTS_QTY; i++)
+		inputLvls[i] = 0;
+	nowNs = 0;
+	tickCount = 0;
+	taskNtfctnsCount = 0;
+	tmrCmdsFail = false;
+	tmrDaemonBlckd = false;
+	tmrCbsCount = 0;
+	apb1ClkDiv = RCC_HCLK_DIV2;
+	apb2ClkDiv = RCC_HCLK_DIV1;
+	trnstnsCount = 0;
+	gpioCallsCount = 0;
+	crtclSctnsCount = 0;
+	crtclNstngLvl = 0;
+	schdlrSspndLvl = 0;
+
+	return;
+}
+
+void hostSimRunNs(const uint64_t &spanNs){
+	const uint64_t endNs{nowNs + spanNs};
+	uint64_t nxtTickNs{0};
+	uint64_t nxtEvntNs{0};
+	int8_t nxtTim{-1};
+	int8_t nxtSpi{-1};
+
+	for(;;){
+		nxtTickNs = (uint64_t(tickCount) + 1) * NS_PER_TICK;
+		nxtEvntNs = nxtTickNs;
+		nxtTim = -1;
+		nxtSpi = -1;
+		for(uint8_t i{0}; i < STRTD_TIMS_MAX; i++){
+			if(strtdTims[i] && (timsNxtEvntNs[i] < nxtEvntNs)){
+				nxtEvntNs = timsNxtEvntNs[i];
+				nxtTim = i;
+			}
+		}
+		for(uint8_t i{0}; i < STRTD_SPIS_MAX; i++){
+			if(strtdSpis[i] && (spisNxtEvntNs[i] < nxtEvntNs)){
+				nxtEvntNs = spisNxtEvntNs[i];
+				nxtTim = -1;
+				nxtSpi = i;
+			}
+		}
+		if(nxtEvntNs > endNs)
+			break;
+		nowNs = nxtEvntNs;
+		if(nxtSpi >= 0){
+			runSpi(nxtSpi);
+		}
+		else if(nxtTim >= 0){
+			TIM_HandleTypeDef* htim{strtdTims[nxtTim]};
+			timsNxtEvntNs[nxtTim] += timPeriodNs(htim);
+			if(htim->PeriodElapsedCallback)
+				htim->PeriodElapsedCallback(htim);
+		}
+		else{
+			++tickCount;
+			runTmrDaemon();
+		}
+	}
+	nowNs = endNs;
+
+	return;
+}
+
+void hostSimRunMs(const uint32_t &spanMs){
+	hostSimRunNs(uint64_t(spanMs) * 1000000ULL);
+
+	return;
+}
+
+uint64_t hostSimNowNs(){
+
+	return nowNs;
+}
+
+void hostSimSetInputLevel(GPIO_TypeDef* portId, const uint16_t &pinNum, const GPIO_PinState &level){
+	if(level == GPIO_PIN_SET)
+		inputLvls[portId - hostGpioPorts] |= pinNum;
+	else
+		inputLvls[portId - hostGpioPorts] &= ~pinNum;
+
+	return;
+}
+
+void hostSimSetTmrCmdsFail(const bool &fail){
+	tmrCmdsFail = fail;
+
+	return;
+}
+
+void hostSimSetTmrDaemonBlocked(const bool &blocked){
+	tmrDaemonBlckd = blocked;
+
+	return;
+}
+
+uint32_t hostSimTmrCbsCount(){
+
+	return tmrCbsCount;
+}
+
+void hostSimSetApbDivs(const uint32_t &apb1ClkDivNew, const uint32_t &apb2ClkDivNew){
+	apb1ClkDiv = apb1ClkDivNew;
+	apb2ClkDiv = apb2ClkDivNew;
+
+	return;
+}
+
+uint32_t hostSimTrnstnsCount(){
+
+	return trnstnsCount;
+}
+
+bool hostSimGetTrnstn(const uint32_t &trnstnNum, hostPinTrnstn_t &trnstn){
+	bool result{false};
+
+	if((trnstnNum < trnstnsCount) && ((trnstnsCount - trnstnNum) <= HOST_TRNSTN_LOG_LNGTH)){
+		trnstn = trnstnsLog[trnstnNum % HOST_TRNSTN_LOG_LNGTH];
+		result = true;
+	}
+
+	return result;
+}
+
+uint32_t hostSimSpiBytesCount(){
+
+	return spiBytesCount;
+}
+
+bool hostSimGetSpiByte(const uint32_t &byteNum, hostSpiByte_t &spiByte){
+	bool result{false};
+
+	if((byteNum < spiBytesCount) && ((spiBytesCount - byteNum) <= HOST_SPI_LOG_LNGTH)){
+		spiByte = spiLog[byteNum % HOST_SPI_LOG_LNGTH];
+		result = true;
+	}
+
+	return result;
+}
+
+uint32_t hostSimGpioCallsCount(){
+
+	return gpioCallsCount;
+}
+
+uint32_t hostSimCrtclSctnsCount(){
+
+	return crtclSctnsCount;
+}
+
+uint32_t hostSimCrtclNstngLvl(){
+
+	return crtclNstngLvl;
+}
+
+uint32_t hostSimSchdlrSspndLvl(){
+
+	return schdlrSspndLvl;
+}
+
+//--------------------------------------------------------------- HAL stand-in
+
+uint32_t HAL_GetTick(void){
+
+	return uint32_t(nowNs / 1000000ULL);
+}
+
+uint32_t HAL_RCC_GetHCLKFreq(void){
+
+	return HOST_HCLK_HZ;
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void){
+
+	return apbClkHz(apb1ClkDiv);
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void){
+
+	return apbClkHz(apb2ClkDiv);
+}
+
+void HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef* RCC_ClkInitStruct, uint32_t* pFLatency){
+	RCC_ClkInitStruct->ClockType = RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+	RCC_ClkInitStruct->SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+	RCC_ClkInitStruct->AHBCLKDivider = RCC_SYSCLK_DIV1;
+	RCC_ClkInitStruct->APB1CLKDivider = apb1ClkDiv;
+	RCC_ClkInitStruct->APB2CLKDivider = apb2ClkDiv;
+	*pFLatency = 2;
+
+	return;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init){
+	for(uint8_t pos{0}; pos < 16; pos++){
+		if(GPIO_Init->Pin & (1U << pos)){
+			GPIOx->MODER &= ~(uint32_t(0x03U) << (pos * 2));
+			GPIOx->MODER |= (GPIO_Init->Mode & 0x03U) << (pos * 2);
+			if(GPIO_Init->Mode & 0x10U)
+				GPIOx->OTYPER |= (1U << pos);
+			else
+				GPIOx->OTYPER &= ~(1U << pos);
+			GPIOx->OSPEEDR &= ~(uint32_t(0x03U) << (pos * 2));
+			GPIOx->OSPEEDR |= (GPIO_Init->Speed & 0x03U) << (pos * 2);
+		}
+	}
+
+	return;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin){
+	uint8_t pinPos{0};
+
+	++gpioCallsCount;
+	while((pinPos < 15) && !(GPIO_Pin & (1U << pinPos)))
+		++pinPos;
+
+	return pinLvl(GPIOx, GPIO_Pin, pinPos)? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState){
+	++gpioCallsCount;
+	setPinsLvl(GPIOx, GPIO_Pin, PinState == GPIO_PIN_SET);
+
+	return;
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin){
+	uint16_t pinsToSet{static_cast<uint16_t>(GPIO_Pin & ~GPIOx->ODR)};
+	uint16_t pinsToReset{static_cast<uint16_t>(GPIO_Pin & GPIOx->ODR)};
+
+	++gpioCallsCount;
+	setPinsLvl(GPIOx, pinsToSet, true);
+	setPinsLvl(GPIOx, pinsToReset, false);
+
+	return;
+}
+
+//--------------------------------------------------------------- GPIO registers shims
+
+hostIdrReg_t::operator uint32_t() const{
+	GPIO_TypeDef* portId{reinterpret_cast<GPIO_TypeDef*>(reinterpret_cast<uintptr_t>(this) - offsetof(GPIO_TypeDef, IDR))};
+	uint32_t levels{0};
+
+	for(uint8_t pos{0}; pos < 16; pos++){
+		if(pinLvl(portId, uint16_t(1U << pos), pos))
+			levels |= (1U << pos);
+	}
+
+	return levels;
+}
+
+hostBsrrReg_t& hostBsrrReg_t::operator=(const uint32_t &bsrrVal){
+	GPIO_TypeDef* portId{reinterpret_cast<GPIO_TypeDef*>(reinterpret_cast<uintptr_t>(this) - offsetof(GPIO_TypeDef, BSRR))};
+
+	lastWrd = bsrrVal;
+	setPinsLvl(portId, static_cast<uint16_t>((bsrrVal >> 16) & ~bsrrVal), false);
+	setPinsLvl(portId, static_cast<uint16_t>(bsrrVal), true);
+
+	return *this;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef* htim){
+	htim->Instance->PSC = htim->Init.Prescaler;
+	htim->Instance->ARR = htim->Init.Period;
+	htim->State = HAL_TIM_STATE_READY;
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef* htim){
+	HAL_StatusTypeDef result{HAL_ERROR};
+
+	for(uint8_t i{0}; i < STRTD_TIMS_MAX; i++){
+		if(strtdTims[i] == htim){
+			result = HAL_BUSY;
+			break;
+		}
+	}
+	if(result != HAL_BUSY){
+		for(uint8_t i{0}; i < STRTD_TIMS_MAX; i++){
+			if(strtdTims[i] == nullptr){
+				strtdTims[i] = htim;
+				timsNxtEvntNs[i] = nowNs + timPeriodNs(htim);
+				htim->State = HAL_TIM_STATE_BUSY;
+				result = HAL_OK;
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef* htim){
+	for(uint8_t i{0}; i < STRTD_TIMS_MAX; i++){
+		if(strtdTims[i] == htim){
+			strtdTims[i] = nullptr;
+			htim->State = HAL_TIM_STATE_READY;
+		}
+	}
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_OC_Init(TIM_HandleTypeDef* htim){
+
+	return HAL_TIM_Base_Init(htim);
+}
+
+HAL_StatusTypeDef HAL_TIM_OC_ConfigChannel(TIM_HandleTypeDef* htim, TIM_OC_InitTypeDef* sConfig, uint32_t Channel){
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_RegisterCallback(TIM_HandleTypeDef* htim, HAL_TIM_CallbackIDTypeDef CallbackID, pTIM_CallbackTypeDef pCallback){
+	htim->PeriodElapsedCallback = pCallback;
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef* hspi){
+	hspi->State = HAL_SPI_STATE_READY;
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size){
+	HAL_StatusTypeDef result{HAL_ERROR};
+	uint8_t spiPos{static_cast<uint8_t>(hspi->Instance - hostSpiInstances)};
+
+	if(hspi->State != HAL_SPI_STATE_READY){
+		result = HAL_BUSY;
+	}
+	else if((pData != nullptr) && (Size > 0) && (spiPos < STRTD_SPIS_MAX)){
+		hspi->pTxBuffPtr = pData;
+		hspi->TxXferSize = Size;
+		hspi->State = HAL_SPI_STATE_BUSY_TX;
+		strtdSpis[spiPos] = hspi;
+		spisXferPos[spiPos] = 0;
+		spisNxtEvntNs[spiPos] = nowNs + spiByteNs(hspi);
+		result = HAL_OK;
+	}
+
+	return result;
+}
+
+HAL_StatusTypeDef HAL_SPI_RegisterCallback(SPI_HandleTypeDef* hspi, HAL_SPI_CallbackIDTypeDef CallbackID, pSPI_CallbackTypeDef pCallback){
+	if(CallbackID == HAL_SPI_TX_COMPLETE_CB_ID)
+		hspi->TxCpltCallback = pCallback;
+
+	return HAL_OK;
+}
+
+//--------------------------------------------------------------- FreeRTOS stand-in
+
+void vPortEnterCritical(void){
+	if(crtclNstngLvl == 0)
+		++crtclSctnsCount;
+	++crtclNstngLvl;
+
+	return;
+}
+
+void vPortExitCritical(void){
+	if(crtclNstngLvl > 0)
+		--crtclNstngLvl;
+
+	return;
+}
+
+void vTaskSuspendAll(void){
+	++schdlrSspndLvl;
+
+	return;
+}
+
+BaseType_t xTaskResumeAll(void){
+	if(schdlrSspndLvl > 0)
+		--schdlrSspndLvl;
+
+	return pdFALSE;
+}
+
+TickType_t xTaskGetTickCount(void){
+
+	return tickCount;
+}
+
+TickType_t xTaskGetTickCountFromISR(void){
+
+	return tickCount;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void){
+
+	return &taskHndlDummy;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t* pxHigherPriorityTaskWoken){
+	if(xTaskToNotify == &taskHndlDummy)
+		++taskNtfctnsCount;
+	if(pxHigherPriorityTaskWoken)
+		*pxHigherPriorityTaskWoken = pdFALSE;
+
+	return;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait){
+	uint32_t result{taskNtfctnsCount};
+
+	if(taskNtfctnsCount){
+		if(xClearCountOnExit != pdFALSE)
+			taskNtfctnsCount = 0;
+		else
+			--taskNtfctnsCount;
+	}
+
+	return result;
+}
+
+TimerHandle_t xTimerCreate(const char* const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void* const pvTimerID, TimerCallbackFunction_t pxCallbackFunction){
+	TimerHandle_t result{NULL};
+
+	if(xTimerPeriodInTicks > 0){
+		for(uint8_t i{0}; i < TMRS_POOL_LNGTH; i++){
+			if(!tmrsPool[i].inUse){
+				result = &tmrsPool[i];
+				memset(static_cast<void*>(result), 0, sizeof(tmrTimerControl));
+				result->inUse = true;
+				strncpy(result->name, pcTimerName, sizeof(result->name) - 1);
+				result->period = xTimerPeriodInTicks;
+				result->autoReload = (uxAutoReload != pdFALSE);
+				result->tmrId = pvTimerID;
+				result->tmrCb = pxCallbackFunction;
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+TimerHandle_t xTimerCreateStatic(const char* const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void* const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, StaticTimer_t* pxTimerBuffer){
+	//The timers pool is the stand-in static storage, the buffer provided is required but not used
+	TimerHandle_t result{NULL};
+
+	if(pxTimerBuffer)
+		result = xTimerCreate(pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction);
+
+	return result;
+}
+
+BaseType_t xTimerStart(TimerHandle_t xTimer, const TickType_t xTicksToWait){
+	if(tmrCmdsFail)
+		return pdFAIL;
+	xTimer->active = true;
+	xTimer->expiry = tickCount + xTimer->period;
+
+	return pdPASS;
+}
+
+BaseType_t xTimerStop(TimerHandle_t xTimer, const TickType_t xTicksToWait){
+	if(tmrCmdsFail)
+		return pdFAIL;
+	xTimer->active = false;
+
+	return pdPASS;
+}
+
+BaseType_t xTimerReset(TimerHandle_t xTimer, const TickType_t xTicksToWait){
+
+	return xTimerStart(xTimer, xTicksToWait);
+}
+
+BaseType_t xTimerDelete(TimerHandle_t xTimer, const TickType_t xTicksToWait){
+	xTimer->active = false;
+	xTimer->inUse = false;
+
+	return pdPASS;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t xTimer, const TickType_t xNewPeriod, const TickType_t xTicksToWait){
+	BaseType_t result{pdFAIL};
+
+	if((xNewPeriod > 0) && !tmrCmdsFail){
+		xTimer->period = xNewPeriod;
+		result = xTimerStart(xTimer, xTicksToWait);
+	}
+
+	return result;
+}
+
+BaseType_t xTimerIsTimerActive(TimerHandle_t xTimer){
+
+	return xTimer->active? pdTRUE : pdFALSE;
+}
+
+TickType_t xTimerGetPeriod(TimerHandle_t xTimer){
+
+	return xTimer->period;
+}
+
+TickType_t xTimerGetExpiryTime(TimerHandle_t xTimer){
+
+	return xTimer->expiry;
+}
+
+void* pvTimerGetTimerID(const TimerHandle_t xTimer){
+
+	return xTimer->tmrId;
+}
+
+const char* pcTimerGetName(TimerHandle_t xTimer){
+
+	return xTimer->name;
+}
@@ -0,0 +1,159 @@
+/**
+  ******************************************************************************
+  * @file	: hostStandIn.h
+  * @brief	: Control and inspection API of the host HAL/FreeRTOS stand-in layer
+  *
+  * @details The stand-in layer replaces the STM32F4xx HAL and the FreeRTOS kernel services used by the SevenSegDisplays_STM32 library with simple fakes driven by a **virtual clock**, so the library hot paths can be executed and measured repeatably on a development host:
+  * - The virtual clock only advances when hostSimRunNs() or hostSimRunMs() are invoked. While advancing, the FreeRTOS tick is incremented every 1 ms, expired software timers callbacks are executed in expiry order (as the timer daemon would) and the started hardware timers (TIM) period elapsed callbacks are executed at the rate set by their PSC and ARR registers.
+  * - Every GPIO pin level change is recorded in a fixed size transitions log, timestamped with the virtual clock and a sequence number, as several transitions share the same virtual timestamp.
+  * - The SPI DMA transmissions are recorded byte by byte in a fixed size log, timestamped with the virtual clock time each byte is shifted out, and their transmission complete callbacks are executed when the last byte was shifted out.
+ * - Critical sections entries and GPIO HAL calls are counted.
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#ifndef _HOSTSTANDIN_H_
+#define _HOSTSTANDIN_H_
+
+#include <stdint.h>
+#include "stm32f4xx_hal.h"
+#include "FreeRTOS.h"
+
+/**
+ * @brief Recorded GPIO pin level change
+ *
+ * @struct hostPinTrnstn_t
+ */
+struct hostPinTrnstn_t{
+	uint64_t tmStmpNs;	/**< Virtual clock value when the transition took place, in nanoseconds*/
+	uint32_t seqNum;	/**< Transition sequence number, orders the transitions sharing the same timestamp*/
+	GPIO_TypeDef* portId;	/**< Port of the pin changed*/
+	uint16_t pinNum;	/**< Pin changed as a single bit set mask*/
+	uint8_t level;	/**< New pin level*/
+};
+
+const uint32_t HOST_TRNSTN_LOG_LNGTH{1U << 16};	// Transitions log capacity, older transitions are overwritten when exceeded
+
+/**
+ * @brief Recorded SPI transmitted byte
+ *
+ * @struct hostSpiByte_t
+ */
+struct hostSpiByte_t{
+	uint64_t tmStmpNs;	/**< Virtual clock value when the byte was completely shifted out, in nanoseconds*/
+	uint32_t seqNum;	/**< Byte sequence number*/
+	SPI_TypeDef* spiId;	/**< SPI peripheral that transmitted the byte*/
+	uint8_t data;	/**< Byte transmitted*/
+};
+
+const uint32_t HOST_SPI_LOG_LNGTH{1U << 14};	// SPI transmitted bytes log capacity, older bytes are overwritten when exceeded
+
+/**
+ * @brief Restores the stand-in layer to it's power-up state
+ *
+ * Sets the virtual clock and tick count to 0, clears the GPIO and TIM registers, the transitions log and the counters, and frees all the software timers.
+ */
+void hostSimReset();
+/**
+ * @brief Advances the virtual clock executing the events due in the time span, in chronological order
+ *
+ * @param spanNs Nanoseconds to advance the virtual clock.
+ */
+void hostSimRunNs(const uint64_t &spanNs);
+/**
+ * @brief Advances the virtual clock, see hostSimRunNs(const uint64_t &)
+ *
+ * @param spanMs Milliseconds to advance the virtual clock.
+ */
+void hostSimRunMs(const uint32_t &spanMs);
+/**
+ * @brief Gets the virtual clock value
+ *
+ * @return Nanoseconds elapsed since the last hostSimReset()
+ */
+uint64_t hostSimNowNs();
+/**
+ * @brief Sets the level read from a pin not configured as output
+ *
+ * Models the external devices driving the MCU inputs. Pins not configured as outputs read GPIO_PIN_RESET until set by this function. Open drain output pins read the wired AND of the output data register and this level, so a released line (output set) reads the level driven by the external device.
+ *
+ * @param portId Port of the pin.
+ * @param pinNum Pin as a single bit set mask.
+ * @param level Level to be read.
+ */
+void hostSimSetInputLevel(GPIO_TypeDef* portId, const uint16_t &pinNum, const GPIO_PinState &level);
+/**
+ * @brief Makes the software timers commands fail, as they do when the timer daemon command queue is full
+ *
+ * While set xTimerStart(), xTimerStop(), xTimerReset() and xTimerChangePeriod() return pdFAIL with no effect on the timer.
+ *
+ * @param fail true to make the commands fail, false to restore the normal behavior.
+ */
+void hostSimSetTmrCmdsFail(const bool &fail);
+/**
+ * @brief Blocks the software timers daemon, as a higher priority task hogging the CPU does
+ *
+ * While set no software timer callback is invoked. The expirations missed are processed at the first tick after the daemon is unblocked.
+ *
+ * @param blocked true to block the daemon, false to restore the normal behavior.
+ */
+void hostSimSetTmrDaemonBlocked(const bool &blocked);
+/**
+ * @brief Sets the APB buses prescalers, changing the peripherals and timers clocks
+ *
+ * @param apb1ClkDiv APB1 prescaler, RCC_HCLK_DIV1 ~ RCC_HCLK_DIV16, RCC_HCLK_DIV2 after hostSimReset().
+ * @param apb2ClkDiv APB2 prescaler, RCC_HCLK_DIV1 ~ RCC_HCLK_DIV16, RCC_HCLK_DIV1 after hostSimReset().
+ */
+void hostSimSetApbDivs(const uint32_t &apb1ClkDiv, const uint32_t &apb2ClkDiv);
+/**
+ * @brief Gets the number of pin transitions recorded since the last reset, including the overwritten ones
+ */
+uint32_t hostSimTrnstnsCount();
+/**
+ * @brief Gets a recorded pin transition
+ *
+ * @param trnstnNum Sequence number of the transition.
+ * @param trnstn Reference to the structure where the transition data is copied.
+ *
+ * @retval true: The transition is still held by the log and was copied.
+ * @retval false: The transition sequence number was not yet produced or was overwritten.
+ */
+bool hostSimGetTrnstn(const uint32_t &trnstnNum, hostPinTrnstn_t &trnstn);
+/**
+ * @brief Gets the number of bytes transmitted by the SPI peripherals since the last reset, including the overwritten ones
+ */
+uint32_t hostSimSpiBytesCount();
+/**
+ * @brief Gets a recorded SPI transmitted byte
+ *
+ * @param byteNum Sequence number of the byte.
+ * @param spiByte Reference to the structure where the byte data is copied.
+ *
+ * @retval true: The byte is still held by the log and was copied.
+ * @retval false: The byte sequence number was not yet produced or was overwritten.
+ */
+bool hostSimGetSpiByte(const uint32_t &byteNum, hostSpiByte_t &spiByte);
+/**
+ * @brief Gets the number of HAL_GPIO_WritePin(), HAL_GPIO_TogglePin() and HAL_GPIO_ReadPin() invocations since the last reset
+ */
+uint32_t hostSimGpioCallsCount();
+/**
+ * @brief Gets the number of outermost taskENTER_CRITICAL() invocations since the last reset
+ */
+uint32_t hostSimCrtclSctnsCount();
+/**
+ * @brief Gets the current critical sections nesting level
+ */
+uint32_t hostSimCrtclNstngLvl();
+/**
+ * @brief Gets the current vTaskSuspendAll() nesting level
+ */
+uint32_t hostSimSchdlrSspndLvl();
+/**
+ * @brief Gets the number of software timer callbacks invoked by the timers daemon since the last reset
+ */
+uint32_t hostSimTmrCbsCount();
+
+#endif	/* _HOSTSTANDIN_H_ */
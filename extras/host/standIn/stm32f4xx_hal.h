@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file	: stm32f4xx_hal.h
+  * @brief	: Host stand-in for the STM32F4xx HAL main header
+  *
+  * @details Provides the subset of the STM32F4xx HAL types, constants and services used by the SevenSegDisplays_STM32 library, so the library sources can be compiled and run on a development host. Peripheral registers are kept in plain memory, and every GPIO pin transition is recorded with a virtual timestamp, see hostStandIn.h
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#ifndef __STM32F4xx_HAL_H
+#define __STM32F4xx_HAL_H
+
+#include <stdint.h>
+
+typedef enum{
+	RESET = 0U,
+	SET = !RESET
+} FlagStatus, ITStatus;
+
+typedef enum{
+	HAL_OK = 0x00U,
+	HAL_ERROR = 0x01U,
+	HAL_BUSY = 0x02U,
+	HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum{
+	HAL_UNLOCKED = 0x00U,
+	HAL_LOCKED = 0x01U
+} HAL_LockTypeDef;
+
+#define UNUSED(X) (void)X
+
+static inline void __disable_irq(void){}
+static inline void __enable_irq(void){}
+
+uint32_t HAL_GetTick(void);
+
+#include "stm32f4xx_hal_rcc.h"
+#include "stm32f4xx_hal_gpio.h"
+#include "stm32f4xx_hal_tim.h"
+#include "stm32f4xx_hal_spi.h"
+
+#endif	/* __STM32F4xx_HAL_H */
@@ -0,0 +1,108 @@
+/**
+  ******************************************************************************
+  * @file	: stm32f4xx_hal_gpio.h
+  * @brief	: Host stand-in for the STM32F4xx HAL GPIO module
+  *
+  * @details The IDR and BSRR registers are shims behaving as the target's ones, so the library can be built on the host with SEVENSEG_FAST_GPIO set: the IDR reads the pins levels, and each BSRR write changes the pins levels recording the transitions, as HAL_GPIO_WritePin() does.
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#ifndef __STM32F4xx_HAL_GPIO_H
+#define __STM32F4xx_HAL_GPIO_H
+
+#include <stdint.h>
+
+/**
+ * @brief Input data register shim, reads the levels of the port's pins as HAL_GPIO_ReadPin() does
+ *
+ * @struct hostIdrReg_t
+ */
+struct hostIdrReg_t{
+	volatile uint32_t rsrvd;
+	operator uint32_t() const;
+};
+
+/**
+ * @brief Bit set/reset register shim, the pins in the low half word of the word written are set and the ones in the high half word are reset, the set prevailing as in the target's register
+ *
+ * @struct hostBsrrReg_t
+ */
+struct hostBsrrReg_t{
+	volatile uint32_t lastWrd;
+	hostBsrrReg_t& operator=(const uint32_t &bsrrVal);
+};
+
+typedef struct{
+	volatile uint32_t MODER;
+	volatile uint32_t OTYPER;
+	volatile uint32_t OSPEEDR;
+	volatile uint32_t PUPDR;
+	hostIdrReg_t IDR;
+	volatile uint32_t ODR;
+	hostBsrrReg_t BSRR;
+	volatile uint32_t LCKR;
+	volatile uint32_t AFR[2];
+} GPIO_TypeDef;
+
+typedef struct{
+	uint32_t Pin;
+	uint32_t Mode;
+	uint32_t Pull;
+	uint32_t Speed;
+	uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+typedef enum{
+	GPIO_PIN_RESET = 0,
+	GPIO_PIN_SET
+} GPIO_PinState;
+
+#define HOST_GPIO_PORTS_QTY	5U
+extern GPIO_TypeDef hostGpioPorts[HOST_GPIO_PORTS_QTY];
+
+#define GPIOA	(&hostGpioPorts[0])
+#define GPIOB	(&hostGpioPorts[1])
+#define GPIOC	(&hostGpioPorts[2])
+#define GPIOD	(&hostGpioPorts[3])
+#define GPIOE	(&hostGpioPorts[4])
+
+#define GPIO_PIN_0	((uint16_t)0x0001)
+#define GPIO_PIN_1	((uint16_t)0x0002)
+#define GPIO_PIN_2	((uint16_t)0x0004)
+#define GPIO_PIN_3	((uint16_t)0x0008)
+#define GPIO_PIN_4	((uint16_t)0x0010)
+#define GPIO_PIN_5	((uint16_t)0x0020)
+#define GPIO_PIN_6	((uint16_t)0x0040)
+#define GPIO_PIN_7	((uint16_t)0x0080)
+#define GPIO_PIN_8	((uint16_t)0x0100)
+#define GPIO_PIN_9	((uint16_t)0x0200)
+#define GPIO_PIN_10	((uint16_t)0x0400)
+#define GPIO_PIN_11	((uint16_t)0x0800)
+#define GPIO_PIN_12	((uint16_t)0x1000)
+#define GPIO_PIN_13	((uint16_t)0x2000)
+#define GPIO_PIN_14	((uint16_t)0x4000)
+#define GPIO_PIN_15	((uint16_t)0x8000)
+#define GPIO_PIN_All	((uint16_t)0xFFFF)
+
+#define GPIO_MODE_INPUT	0x00000000U
+#define GPIO_MODE_OUTPUT_PP	0x00000001U
+#define GPIO_MODE_OUTPUT_OD	0x00000011U
+
+#define GPIO_NOPULL	0x00000000U
+#define GPIO_PULLUP	0x00000001U
+#define GPIO_PULLDOWN	0x00000002U
+
+#define GPIO_SPEED_FREQ_LOW	0x00000000U
+#define GPIO_SPEED_FREQ_MEDIUM	0x00000001U
+#define GPIO_SPEED_FREQ_HIGH	0x00000002U
+#define GPIO_SPEED_FREQ_VERY_HIGH	0x00000003U
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_GPIO_TogglePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+
+#endif	/* __STM32F4xx_HAL_GPIO_H */
@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file	: stm32f4xx_hal_rcc.h
+  * @brief	: Host stand-in for the STM32F4xx HAL RCC module
+  *
+  * @details Models the bus clocks of a STM32F401 at HOST_HCLK_HZ, the APB prescalers set with hostSimSetApbDivs() (the APB1 divided by 2 and the APB2 undivided after hostSimReset()). As on the target, the timers kernel clock is their APB bus clock, doubled when the APB prescaler is not 1.
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#ifndef __STM32F4xx_HAL_RCC_H
+#define __STM32F4xx_HAL_RCC_H
+
+#include <stdint.h>
+
+#define HOST_HCLK_HZ	84000000UL
+
+#define RCC_CLOCKTYPE_SYSCLK	0x00000001U
+#define RCC_CLOCKTYPE_HCLK	0x00000002U
+#define RCC_CLOCKTYPE_PCLK1	0x00000004U
+#define RCC_CLOCKTYPE_PCLK2	0x00000008U
+
+#define RCC_SYSCLKSOURCE_PLLCLK	0x00000002U
+#define RCC_SYSCLK_DIV1	0x00000000U
+
+#define RCC_HCLK_DIV1	0x00000000U
+#define RCC_HCLK_DIV2	0x00001000U
+#define RCC_HCLK_DIV4	0x00001400U
+#define RCC_HCLK_DIV8	0x00001800U
+#define RCC_HCLK_DIV16	0x00001C00U
+
+typedef struct{
+	uint32_t ClockType;
+	uint32_t SYSCLKSource;
+	uint32_t AHBCLKDivider;
+	uint32_t APB1CLKDivider;
+	uint32_t APB2CLKDivider;
+} RCC_ClkInitTypeDef;
+
+uint32_t HAL_RCC_GetHCLKFreq(void);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint32_t HAL_RCC_GetPCLK2Freq(void);
+void HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef* RCC_ClkInitStruct, uint32_t* pFLatency);
+
+#endif	/* __STM32F4xx_HAL_RCC_H */
@@ -0,0 +1,91 @@
+/**
+  ******************************************************************************
+  * @file	: stm32f4xx_hal_spi.h
+  * @brief	: Host stand-in for the STM32F4xx HAL SPI module
+  *
+  * @details Loopback SPI: the bytes of the DMA transmissions are recorded in a log with the virtual clock timestamp they are shifted out, and the transmission complete callback is executed when the last byte was shifted out, as the virtual clock is advanced. The SPI kernel clock is HOST_SPI_CLK_HZ, divided by the baud rate prescaler set.
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#ifndef __STM32F4xx_HAL_SPI_H
+#define __STM32F4xx_HAL_SPI_H
+
+#include <stdint.h>
+
+#define HOST_SPI_CLK_HZ	84000000UL
+
+typedef struct{
+	volatile uint32_t CR1;
+	volatile uint32_t CR2;
+	volatile uint32_t SR;
+	volatile uint32_t DR;
+} SPI_TypeDef;
+
+#define HOST_SPI_QTY	4U
+extern SPI_TypeDef hostSpiInstances[HOST_SPI_QTY];
+
+#define SPI1	(&hostSpiInstances[1])
+#define SPI2	(&hostSpiInstances[2])
+#define SPI3	(&hostSpiInstances[3])
+
+typedef struct{
+	uint32_t Mode;
+	uint32_t Direction;
+	uint32_t DataSize;
+	uint32_t CLKPolarity;
+	uint32_t CLKPhase;
+	uint32_t NSS;
+	uint32_t BaudRatePrescaler;
+	uint32_t FirstBit;
+	uint32_t TIMode;
+	uint32_t CRCCalculation;
+	uint32_t CRCPolynomial;
+} SPI_InitTypeDef;
+
+typedef enum{
+	HAL_SPI_STATE_RESET = 0x00U,
+	HAL_SPI_STATE_READY = 0x01U,
+	HAL_SPI_STATE_BUSY_TX = 0x03U
+} HAL_SPI_StateTypeDef;
+
+typedef struct __SPI_HandleTypeDef{
+	SPI_TypeDef* Instance;
+	SPI_InitTypeDef Init;
+	uint8_t* pTxBuffPtr;
+	uint16_t TxXferSize;
+	HAL_SPI_StateTypeDef State;
+	void (*TxCpltCallback)(struct __SPI_HandleTypeDef* hspi);
+} SPI_HandleTypeDef;
+
+typedef void (*pSPI_CallbackTypeDef)(SPI_HandleTypeDef* hspi);
+typedef enum{
+	HAL_SPI_TX_COMPLETE_CB_ID = 0x00U
+} HAL_SPI_CallbackIDTypeDef;
+
+#define SPI_MODE_MASTER	0x00000104U
+#define SPI_DIRECTION_2LINES	0x00000000U
+#define SPI_DIRECTION_1LINE	0x00008000U
+#define SPI_DATASIZE_8BIT	0x00000000U
+#define SPI_POLARITY_LOW	0x00000000U
+#define SPI_PHASE_1EDGE	0x00000000U
+#define SPI_NSS_SOFT	0x00000200U
+#define SPI_BAUDRATEPRESCALER_2	0x00000000U
+#define SPI_BAUDRATEPRESCALER_4	0x00000008U
+#define SPI_BAUDRATEPRESCALER_8	0x00000010U
+#define SPI_BAUDRATEPRESCALER_16	0x00000018U
+#define SPI_BAUDRATEPRESCALER_32	0x00000020U
+#define SPI_BAUDRATEPRESCALER_64	0x00000028U
+#define SPI_BAUDRATEPRESCALER_128	0x00000030U
+#define SPI_BAUDRATEPRESCALER_256	0x00000038U
+#define SPI_FIRSTBIT_MSB	0x00000000U
+#define SPI_TIMODE_DISABLE	0x00000000U
+#define SPI_CRCCALCULATION_DISABLE	0x00000000U
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef* hspi);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_RegisterCallback(SPI_HandleTypeDef* hspi, HAL_SPI_CallbackIDTypeDef CallbackID, pSPI_CallbackTypeDef pCallback);
+
+#endif	/* __STM32F4xx_HAL_SPI_H */
@@ -0,0 +1,100 @@
+/**
+  ******************************************************************************
+  * @file	: stm32f4xx_hal_tim.h
+  * @brief	: Host stand-in for the STM32F4xx HAL TIM module
+  *
+  * @details Started timers with update interrupt enabled generate their period elapsed callbacks when the host stand-in virtual clock is advanced. The timers kernel clock is derived from the stand-in bus clocks as on the target, see stm32f4xx_hal_rcc.h
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#ifndef STM32F4xx_HAL_TIM_H
+#define STM32F4xx_HAL_TIM_H
+
+#include <stdint.h>
+
+typedef struct{
+	volatile uint32_t CR1;
+	volatile uint32_t CR2;
+	volatile uint32_t SMCR;
+	volatile uint32_t DIER;
+	volatile uint32_t SR;
+	volatile uint32_t EGR;
+	volatile uint32_t CCMR1;
+	volatile uint32_t CCMR2;
+	volatile uint32_t CCER;
+	volatile uint32_t CNT;
+	volatile uint32_t PSC;
+	volatile uint32_t ARR;
+} TIM_TypeDef;
+
+#define HOST_TIM_QTY	14U
+extern TIM_TypeDef hostTimInstances[HOST_TIM_QTY];
+
+#define TIM1	(&hostTimInstances[1])
+#define TIM2	(&hostTimInstances[2])
+#define TIM3	(&hostTimInstances[3])
+#define TIM4	(&hostTimInstances[4])
+#define TIM5	(&hostTimInstances[5])
+#define TIM9	(&hostTimInstances[9])
+#define TIM10	(&hostTimInstances[10])
+#define TIM11	(&hostTimInstances[11])
+
+typedef struct{
+	uint32_t Prescaler;
+	uint32_t CounterMode;
+	uint32_t Period;
+	uint32_t ClockDivision;
+	uint32_t RepetitionCounter;
+	uint32_t AutoReloadPreload;
+} TIM_Base_InitTypeDef;
+
+typedef struct{
+	uint32_t OCMode;
+	uint32_t Pulse;
+	uint32_t OCPolarity;
+	uint32_t OCNPolarity;
+	uint32_t OCFastMode;
+	uint32_t OCIdleState;
+	uint32_t OCNIdleState;
+} TIM_OC_InitTypeDef;
+
+typedef enum{
+	HAL_TIM_STATE_RESET = 0x00U,
+	HAL_TIM_STATE_READY = 0x01U,
+	HAL_TIM_STATE_BUSY = 0x02U
+} HAL_TIM_StateTypeDef;
+
+typedef struct __TIM_HandleTypeDef{
+	TIM_TypeDef* Instance;
+	TIM_Base_InitTypeDef Init;
+	HAL_TIM_StateTypeDef State;
+	void (*PeriodElapsedCallback)(struct __TIM_HandleTypeDef* htim);
+} TIM_HandleTypeDef;
+
+typedef void (*pTIM_CallbackTypeDef)(TIM_HandleTypeDef* htim);
+typedef uint32_t HAL_TIM_CallbackIDTypeDef;
+
+#define TIM_COUNTERMODE_UP	0x00000000U
+#define TIM_CLOCKDIVISION_DIV1	0x00000000U
+#define TIM_AUTORELOAD_PRELOAD_DISABLE	0x00000000U
+#define TIM_AUTORELOAD_PRELOAD_ENABLE	0x00000080U
+#define TIM_OCMODE_TIMING	0x00000000U
+#define TIM_OCPOLARITY_HIGH	0x00000000U
+#define TIM_OCFAST_DISABLE	0x00000000U
+#define TIM_CHANNEL_1	0x00000000U
+
+#define __HAL_TIM_SET_AUTORELOAD(__HANDLE__, __AUTORELOAD__)	\
+	do{ (__HANDLE__)->Instance->ARR = (__AUTORELOAD__); (__HANDLE__)->Init.Period = (__AUTORELOAD__); }while(0)
+#define __HAL_TIM_GET_AUTORELOAD(__HANDLE__)	((__HANDLE__)->Instance->ARR)
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef* htim);
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef* htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef* htim);
+HAL_StatusTypeDef HAL_TIM_OC_Init(TIM_HandleTypeDef* htim);
+HAL_StatusTypeDef HAL_TIM_OC_ConfigChannel(TIM_HandleTypeDef* htim, TIM_OC_InitTypeDef* sConfig, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_RegisterCallback(TIM_HandleTypeDef* htim, HAL_TIM_CallbackIDTypeDef CallbackID, pTIM_CallbackTypeDef pCallback);
+
+#endif	/* STM32F4xx_HAL_TIM_H */
@@ -0,0 +1,33 @@
+/**
+  ******************************************************************************
+  * @file	: task.h
+  * @brief	: Host stand-in for the FreeRTOS task services
+  *
+  * @details Critical sections and the scheduler suspension are emulated as nesting counters, and the tick count is taken from the host stand-in virtual clock. Direct to task notifications are counted for the single host task, ulTaskNotifyTake() never blocks.
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void* TaskHandle_t;
+
+void vPortEnterCritical(void);
+void vPortExitCritical(void);
+void vTaskSuspendAll(void);
+BaseType_t xTaskResumeAll(void);
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t* pxHigherPriorityTaskWoken);
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait);
+
+#define taskENTER_CRITICAL()	vPortEnterCritical()
+#define taskEXIT_CRITICAL()	vPortExitCritical()
+
+#endif	/* INC_TASK_H */
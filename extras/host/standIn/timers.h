@@ -0,0 +1,36 @@
+/**
+  ******************************************************************************
+  * @file	: timers.h
+  * @brief	: Host stand-in for the FreeRTOS software timers services
+  *
+  * @details Software timers are kept in a fixed size pool (no host heap is used) and their callbacks are executed by the host stand-in virtual timer daemon, when the virtual clock is advanced by hostSimRunNs() or hostSimRunMs().
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#ifndef INC_TIMERS_H
+#define INC_TIMERS_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+struct tmrTimerControl;
+typedef struct tmrTimerControl* TimerHandle_t;
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t xTimer);
+
+TimerHandle_t xTimerCreate(const char* const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void* const pvTimerID, TimerCallbackFunction_t pxCallbackFunction);
+TimerHandle_t xTimerCreateStatic(const char* const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void* const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, StaticTimer_t* pxTimerBuffer);
+BaseType_t xTimerStart(TimerHandle_t xTimer, const TickType_t xTicksToWait);
+BaseType_t xTimerStop(TimerHandle_t xTimer, const TickType_t xTicksToWait);
+BaseType_t xTimerReset(TimerHandle_t xTimer, const TickType_t xTicksToWait);
+BaseType_t xTimerDelete(TimerHandle_t xTimer, const TickType_t xTicksToWait);
+BaseType_t xTimerChangePeriod(TimerHandle_t xTimer, const TickType_t xNewPeriod, const TickType_t xTicksToWait);
+BaseType_t xTimerIsTimerActive(TimerHandle_t xTimer);
+TickType_t xTimerGetPeriod(TimerHandle_t xTimer);
+TickType_t xTimerGetExpiryTime(TimerHandle_t xTimer);
+void* pvTimerGetTimerID(const TimerHandle_t xTimer);
+const char* pcTimerGetName(TimerHandle_t xTimer);
+
+#endif	/* INC_TIMERS_H */
@@ -0,0 +1,134 @@
+/**
+  ******************************************************************************
+  * @file	: sevenSegTrcDecode.cpp
+  * @brief	: Host decoder for the SevenSegDisplays_STM32 library trace ring buffers dumps
+  *
+  * @details Reads one or more raw dumps of SevenSegDispHw trace ring buffers (SEVENSEG_TRACE_LEN entries of 12 bytes each, little endian, as found in the target memory, see SevenSegDispHw::getTrcBffrPtr()), merges the valid entries of all of them by their sequence number and prints the resulting timeline, one event per line:
+  * - Sequence number.
+  * - Time since the first event decoded, in microseconds.
+  * - Time since the previous event decoded, in microseconds.
+  * - Hardware display instance number.
+  * - Event name and it's decoded argument.
+  *
+  * The timestamps are the statsCycCnt() 32 bits values, the elapsed time between consecutive events decoded must be shorter than half the counter wrap around time (12.7 seconds for a 168 MHz core clock, 2.1 seconds for the host stand-in nanoseconds).
+  *
+  * Usage: sevenSegTrcDecode [-c cyclesPerUs] dumpFile [dumpFile...]
+  * - cyclesPerUs: statsCycCnt() counts per microsecond, the core clock in MHz for the target dumps (default 1000, the host stand-in build nanoseconds).
+  *
+  * @author	: Gabriel D. Goldman
+  * @date	: Created on: 16/10/2026
+  *
+  ******************************************************************************
+  */
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "sevenSegDispHw.h"
+
+static const char* const TRC_EVT_NAMES[]{"none", "print_bgn", "print_end", "bffr_chng", "rfrsh_slot", "tm_frm_strt", "tm_frm_stop", "blink_tgl", "wait_tgl"};
+static const char* const TRC_PRINT_KNDS[]{"text", "int", "double", "fixed"};
+
+//--------------------------------------------------------------- Dump parsing
+static uint32_t rdLe32(const uint8_t* bytesPtr){
+
+	return uint32_t(bytesPtr[0]) | (uint32_t(bytesPtr[1]) << 8) | (uint32_t(bytesPtr[2]) << 16) | (uint32_t(bytesPtr[3]) << 24);
+}
+
+static bool loadDump(const char* fileName, std::vector<trcEvt_t> &evts){
+	uint8_t entryBytes[sizeof(trcEvt_t)];
+	trcEvt_t evt{};
+	std::FILE* dumpFile{std::fopen(fileName, "rb")};
+
+	if(!dumpFile){
+		std::fprintf(stderr, "sevenSegTrcDecode: can't open %s\n", fileName);
+		return false;
+	}
+	while(std::fread(entryBytes, sizeof(entryBytes), 1, dumpFile) == 1){
+		evt.seqNum = rdLe32(entryBytes);
+		evt.tmStmp = rdLe32(entryBytes + 4);
+		evt.evtId = entryBytes[8];
+		evt.dspHwInstNbr = entryBytes[9];
+		evt.arg = uint16_t(entryBytes[10] | (entryBytes[11] << 8));
+		if(evt.seqNum && (evt.evtId != trcNone))	//Unused entries, and the ones being written when dumped, are discarded
+			evts.push_back(evt);
+	}
+	std::fclose(dumpFile);
+
+	return true;
+}
+
+//--------------------------------------------------------------- Timeline output
+static void printDetail(const trcEvt_t &evt){
+	switch(evt.evtId){
+	case trcPrintBgn:
+		std::printf("%s", (evt.arg <= trcPrintFxd)? TRC_PRINT_KNDS[evt.arg] : "?");
+		break;
+	case trcPrintEnd:
+		std::printf("%s", evt.arg? "displayed" : "rejected");
+		break;
+	case trcBffrChng:
+		std::printf("digits 0x%04X", evt.arg);
+		break;
+	case trcRfrshSlot:
+		std::printf("slot %u", evt.arg & 0xFF);
+		if(evt.arg >> 8)
+			std::printf(" bcm 0x%02X", evt.arg >> 8);
+		break;
+	case trcTmFrmStrt:
+		std::printf("%u bytes", evt.arg);
+		break;
+	case trcTmFrmStop:
+		std::printf("%s", evt.arg? "aborted" : "sent");
+		break;
+	case trcBlinkTgl:
+		std::printf("%s", evt.arg? "on" : "off");
+		break;
+	case trcWaitTgl:
+		std::printf("%u chars", evt.arg);
+		break;
+	default:
+		std::printf("arg 0x%04X", evt.arg);
+		break;
+	}
+
+	return;
+}
+
+int main(int argc, char* argv[]){
+	double cycPerUs{1000.0};
+	std::vector<trcEvt_t> evts{};
+	int64_t tmCyc{0};
+	int32_t dltCyc{0};
+
+	int argPos{1};
+	if((argc > 2) && !std::strcmp(argv[1], "-c")){
+		cycPerUs = std::strtod(argv[2], nullptr);
+		argPos = 3;
+	}
+	if((argPos >= argc) || (cycPerUs <= 0.0)){
+		std::fprintf(stderr, "Usage: sevenSegTrcDecode [-c cyclesPerUs] dumpFile [dumpFile...]\n");
+		return 1;
+	}
+	for(; argPos < argc; ++argPos){
+		if(!loadDump(argv[argPos], evts))
+			return 1;
+	}
+	std::sort(evts.begin(), evts.end(), [](const trcEvt_t &lhs, const trcEvt_t &rhs){ return lhs.seqNum < rhs.seqNum; });
+
+	std::printf("%10s %12s %10s %3s  %-12s %s\n", "seq", "time_us", "delta_us", "hw", "event", "detail");
+	for(size_t i{0}; i < evts.size(); ++i){
+		const trcEvt_t &evt{evts[i]};
+		//The signed difference absorbs the counter wrap around, and the small negative deltas of events timestamped after being numbered by a preempted producer
+		dltCyc = i? static_cast<int32_t>(evt.tmStmp - evts[i - 1].tmStmp) : 0;
+		tmCyc += dltCyc;
+		std::printf("%10u %12.3f %10.3f %3u  %-12s ", evt.seqNum, tmCyc / cycPerUs, dltCyc / cycPerUs, evt.dspHwInstNbr,
+				(evt.evtId < (sizeof(TRC_EVT_NAMES) / sizeof(TRC_EVT_NAMES[0])))? TRC_EVT_NAMES[evt.evtId] : "?");
+		printDetail(evt);
+		std::printf("\n");
+	}
+
+	return 0;
+}
@@ -6,6 +6,9 @@
  * @date		: Created on: Nov 16, 2023
  */
 #include "sevenSegDispHw.h"
+#if SEVENSEG_CYC_CNT && SEVENSEG_HOST_STANDIN
+	#include <chrono>
+#endif
 
 /*Prototype for a SevenSegDispHw classes and SUBClasses timer callback function
 static void  tmrStaticCbBlink(TimerHandle_t blinkTmrCbArg){
@@ -19,14 +22,50 @@ const int MAX_DIGITS_PER_DISPLAY{16};
 const uint8_t diyMore8Bits[8] {3, 2, 1, 0, 7, 6, 5, 4};
 const uint8_t noName4Bits[4] {0, 1, 2, 3};
 
+const uint32_t TMR_CNT_CLK_HZ{1000000};	// Refresh and TM163X transmission timers counter clock, periods set in microseconds
+const uint32_t HC595_GPIO_SPEED{SEVENSEG_FAST_GPIO? GPIO_SPEED_FREQ_HIGH : GPIO_SPEED_FREQ_LOW};	// 74HC595 lines output speed, the direct registers access path needs the fast edges, see SEVENSEG_FAST_GPIO_RDS
+
+const uint8_t TM163X_DATA_CMD_AUTO{0x40};	// Command1: data write, address auto-increment
+const uint8_t TM163X_DATA_CMD_FIXED{0x44};	// Command1: data write, fixed address
+const uint8_t TM163X_ADDR_CMD{0xC0};	// Command2: address setting, OR'ed with the display address
+const uint8_t TM163X_DSP_CTRL_CMD{0x88};	// Command3: display on, OR'ed with the brightness level
+const uint8_t TM163X_BYTE_CLKS{9};	// CLK periods to transmit a byte: 8 data bits + ACK
+const uint8_t TM163X_FRM_CLKS{4};	// CLK periods of a frame Start + Stop signaling overhead
+const uint8_t TM163X_ACK_TMOUT_TCKS{10};	// Timer interrupts waited for the chip to pull DIO low before aborting the transmission
+const uint8_t TM163X_MAX_MRG_GAP{(TM163X_FRM_CLKS + TM163X_BYTE_CLKS) / TM163X_BYTE_CLKS};	// Unchanged addresses between runs resent instead of starting a new address frame
+
 //--------------------------------------------------------------- User Function prototypes
 void Error_Handler(void);
 bool setGPIOPinAsInput(const gpioPinId_t &inPin);
-bool setGPIOPinAsOutput(const gpioPinId_t &outPin);
-void txTM163xTmrCB(TIM_HandleTypeDef *htim);
+bool setGPIOPinAsOutput(const gpioPinId_t &outPin, bool openDrain = false, const uint32_t &speed = GPIO_SPEED_FREQ_LOW);
+void gpioBsrrWrite(GPIO_TypeDef* portId, const uint32_t &bsrrVal);
+void gpioWrWait(GPIO_TypeDef* portId);
+uint16_t gpioIdrRead(GPIO_TypeDef* portId, const uint16_t &pinsMsk);
+uint32_t getTmrClkFrq(const TIM_TypeDef* tmrInst);
+uint32_t getTmrArrMax(const TIM_TypeDef* tmrInst);
+#if SEVENSEG_RFRSH_STATS
+const uint8_t RFRSH_JTTR_BINS_PCNT[RFRSH_JTTR_BINS - 1]{1, 2, 5, 10, 25, 50, 100};	// Jitter histogram bins upper limits, in percent of the nominal period
+#endif
 //--------------------------------------------------------------- User Static variables
 uint8_t SevenSegDispHw::_dspHwSerialNum = 0;
+#if SEVENSEG_TRACE
+std::atomic<uint32_t> SevenSegDispHw::_trcSeqNum{0};
+#endif
 uint8_t SevenSegTM163X::_usTmrUsrs = 0;
+TIM_HandleTypeDef SevenSegTM163X::_txTM163xTmr{};
+SevenSegTM163X* SevenSegTM163X::_txActvInstPtr = nullptr;
+SevenSegTM163X* SevenSegTM163X::_txWtngHdPtr = nullptr;
+SevenSegTM163X* SevenSegTM163X::_txWtngTlPtr = nullptr;
+SevenSegTM163XBus* SevenSegTM163X::_txActvBusPtr = nullptr;
+SevenSegDynamic* SevenSegDynamic::_isrDspsLst[SevenSegDynamic::_isrDspsQtyMax]{};
+SevenSegDynamic* SevenSegDynamic::_rfrshDspchLst[SevenSegDynamic::_rfrshDspchQtyMax]{};
+uint8_t SevenSegDynamic::_rfrshDspchQty = 0;
+TimerHandle_t SevenSegDynamic::_rfrshDspchTmrHndl = NULL;
+#if configSUPPORT_STATIC_ALLOCATION
+StaticTimer_t SevenSegDynamic::_rfrshDspchTmrBffr{};
+#endif
+TickType_t SevenSegDynamic::_rfrshDspchPrd = 0;
+SevenSegDynHC595Spi* SevenSegDynHC595Spi::_spiDspsLst[SevenSegDynHC595Spi::_spiDspsQtyMax]{};
 
 //============================================================> Class methods separator
 
@@ -35,12 +74,15 @@ SevenSegDispHw::SevenSegDispHw()
 }
 
 SevenSegDispHw::SevenSegDispHw(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode)
-:_ioPins{ioPins}, _digitPosPtr{new uint8_t[dspDigits]}, _dspDigitsQty {dspDigits}, _commAnode {commAnode}
+:_ioPins{ioPins}, _digitPosPtr{new uint8_t[dspDigits]}, _dspDigitsQty {dspDigits}, _commAnode {commAnode}, _segsPlrtyMsk {static_cast<uint8_t>(commAnode? 0x00 : 0xFF)}
 {
     _dspHwInstNbr = _dspHwSerialNum++;
     for (uint8_t i{0}; i < _dspDigitsQty; i++){
         *(_digitPosPtr + i) = i;
     }
+#if SEVENSEG_TRACE
+    statsCycCntInit();
+#endif
 }
 
 SevenSegDispHw::~SevenSegDispHw() {
@@ -85,17 +127,68 @@ bool SevenSegDispHw::setDigitsOrder(uint8_t* newOrderPtr){
         for(int i {0}; i < _dspDigitsQty; i++){
             *(_digitPosPtr + i) = *(newOrderPtr + i);
         }
+        dspBffrCntntChng();
     }
 
     return result;
 }
 
+void SevenSegDispHw::dspBffrCntntChng(){
+	dspBffrCntntChng(static_cast<uint16_t>((uint32_t(1) << _dspDigitsQty) - 1));
+
+	return;
+}
+
+#if SEVENSEG_STATS
+dspHwStats_t SevenSegDispHw::getStats(){
+	dspHwStats_t result{};
+
+	taskENTER_CRITICAL();
+	result = _hwStats;
+	taskEXIT_CRITICAL();
+
+	return result;
+}
+
+void SevenSegDispHw::resetStats(){
+	taskENTER_CRITICAL();
+	_hwStats = dspHwStats_t{};
+	taskEXIT_CRITICAL();
+
+	return;
+}
+#endif
+
 void SevenSegDispHw::setDspBuffPtr(uint8_t* newDspBuffPtr){
     _dspBuffPtr = newDspBuffPtr;
 
     return;
 }
 
+#if SEVENSEG_TRACE
+const trcEvt_t* SevenSegDispHw::getTrcBffrPtr(){
+
+	return _trcBffr;
+}
+
+void SevenSegDispHw::trace(const uint8_t &evtId, const uint16_t &arg){
+	//The entry is claimed and numbered with single atomic increments, no retries nor locks. A 0 sequence number marks the entry invalid while it's being written
+	trcEvt_t* evtPtr{_trcBffr + (_trcHd.fetch_add(1, std::memory_order_relaxed) & (SEVENSEG_TRACE_LEN - 1))};
+	uint32_t seqNum{_trcSeqNum.fetch_add(1, std::memory_order_relaxed) + 1};
+
+	evtPtr->seqNum = 0;
+	std::atomic_signal_fence(std::memory_order_release);
+	evtPtr->tmStmp = statsCycCnt();
+	evtPtr->evtId = evtId;
+	evtPtr->dspHwInstNbr = _dspHwInstNbr;
+	evtPtr->arg = arg;
+	std::atomic_signal_fence(std::memory_order_release);
+	evtPtr->seqNum = seqNum? seqNum : 1;	//The sequence number wraps skipping the invalid mark
+
+	return;
+}
+#endif
+
 //============================================================> Class methods separator
 
 SevenSegDynamic::SevenSegDynamic()
@@ -103,47 +196,147 @@ SevenSegDynamic::SevenSegDynamic()
 }
 
 SevenSegDynamic::SevenSegDynamic(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode)
-:SevenSegDispHw(ioPins, dspDigits, commAnode)
+:SevenSegDispHw(ioPins, dspDigits, commAnode), _rfrshFrmPtr{new uint16_t[dspDigits]{}}, _dgtBrghtnssPtr{new uint8_t[dspDigits]{}}
 {
+	_rfrshSlotsQty = dspDigits;
+	_rfrshOffWrd = static_cast<uint16_t>(uint16_t(0xFF ^ _segsPlrtyMsk) << 8);
+#if SEVENSEG_RFRSH_STATS
+	statsCycCntInit();
+#endif
 }
 
 SevenSegDynamic::~SevenSegDynamic()
 {
-   if(_dspRfrshTmrHndl){   //if the timer still exists and is running, stop and delete
+   if(_rfrshDspchd || _rfrshHwTmrPtr){   //if the display is still being refreshed, stop it
    	end();
    }
+   delete [] _rfrshFrmPtr;
+   delete [] _dgtBrghtnssPtr;
 }
 
-bool SevenSegDynamic::begin(const unsigned long int &rfrshFrq){
-	bool result {false};
-   BaseType_t tmrModResult {pdFAIL};
-   TickType_t tmrRfrshFrqInTcks{0};
+void SevenSegDynamic::dspBffrCntntChng(const uint16_t &chngdDgtsMsk){
+#if SEVENSEG_STATS
+	++_hwStats.ntfctnsCnt;
+#endif
+#if SEVENSEG_TRACE
+	trace(trcBffrChng, chngdDgtsMsk);
+#endif
+	if(_dspBuffPtr && _rfrshFrmPtr){
+		for(uint8_t i{0}; i < _dspDigitsQty; ++i){
+			if(chngdDgtsMsk & (uint16_t(1) << i))	//A halfword write, the refresh interrupts never read a torn word
+				*(_rfrshFrmPtr + i) = static_cast<uint16_t>((uint16_t(*(_dspBuffPtr + i) ^ _segsPlrtyMsk) << 8) | (uint8_t(1) << *(_digitPosPtr + i)));
+		}
+	}
 
-   SevenSegDispHw::begin();
+	return;
+}
 
-   //Verify if the timer service was attached by checking if the Timer Handle is valid (also verify the timer was started)
-	if (!_svnSgDynTmrHndl){
-		if (rfrshFrq)	//Calculate the Timer Period
-			tmrRfrshFrqInTcks = pdMS_TO_TICKS(rfrshFrq);
-		else
-			tmrRfrshFrqInTcks = pdMS_TO_TICKS(static_cast<int>(1000/(30 * _dspDigitsQty)));
-		//Create a valid unique Name for identifying the timer created for this Dynamic Display
-		std::string _svnSgDynSerNumStr{ "00" + std::to_string((int)_dspHwInstNbr) };
-		_svnSgDynSerNumStr = _svnSgDynSerNumStr.substr(_svnSgDynSerNumStr.length() - 2, 2);
-		std::string _svnSgDynRfrshTmrName {"DynDsp"};
-		_svnSgDynRfrshTmrName = _svnSgDynRfrshTmrName + _svnSgDynSerNumStr + "rfrsh_tmr";
-		//Initialize the Display refresh timer. Considering each digit to be refreshed at 30 Hz in turn, the freq might be (Max qty of digits * 30Hz)
-		_dspRfrshTmrHndl = xTimerCreate(
-							_svnSgDynRfrshTmrName.c_str(),
-							tmrRfrshFrqInTcks,	//Timer period
+bool SevenSegDynamic::begin(const unsigned long int &rfrshFrq){
+	bool result {false};
+	TickType_t rfrshTcks{0};
+	TickType_t prvDspchPrd{_rfrshDspchPrd};
+
+	if(_rfrshDspchd || _rfrshHwTmrPtr)
+		return result;
+	if (rfrshFrq)	//Calculate the digit period
+		rfrshTcks = pdMS_TO_TICKS(rfrshFrq);
+	else
+		rfrshTcks = pdMS_TO_TICKS(static_cast<int>(1000/(30 * _rfrshSlotsQty)));
+	if(rfrshTcks == 0)
+		rfrshTcks = 1;
+
+	SevenSegDispHw::begin();
+	dspBffrCntntChng();
+	if(!_rfrshDspchTmrHndl){	//The first display registered creates the dispatcher timer, shared by all the dynamic displays. Never deleted, it's statically allocated when supported
+#if configSUPPORT_STATIC_ALLOCATION
+		_rfrshDspchTmrHndl = xTimerCreateStatic(
+							"DynDspRfrshDspch",
+							rfrshTcks,	//Timer period
 							pdTRUE,  //Autoreload
-							this,   //TimerID, data to be passed to the callback function
-							tmrCbRefreshDyn  //Callback function
+							nullptr,   //TimerID, the dispatcher services the registered displays list
+							tmrCbRfrshDspch,  //Callback function
+							&_rfrshDspchTmrBffr
 		);
-		if((_dspRfrshTmrHndl != NULL) && (!xTimerIsTimerActive(_dspRfrshTmrHndl))){
-			tmrModResult = xTimerStart(_dspRfrshTmrHndl, portMAX_DELAY);
-			if (tmrModResult == pdPASS)
-				result = true;
+#else
+		_rfrshDspchTmrHndl = xTimerCreate(
+							"DynDspRfrshDspch",
+							rfrshTcks,	//Timer period
+							pdTRUE,  //Autoreload
+							nullptr,   //TimerID, the dispatcher services the registered displays list
+							tmrCbRfrshDspch  //Callback function
+		);
+#endif
+		prvDspchPrd = 0;
+	}
+	if(_rfrshDspchTmrHndl){
+		taskENTER_CRITICAL();
+		if(_rfrshDspchQty < _rfrshDspchQtyMax){
+			_rfrshDspchLst[_rfrshDspchQty++] = this;
+			_rfrshTcks = rfrshTcks;
+			_rfrshDspchd = true;
+			_rfrshDspchUpd();
+			result = true;
+		}
+		taskEXIT_CRITICAL();
+		if(result){
+			if(_rfrshDspchPrd != prvDspchPrd)
+				xTimerChangePeriod(_rfrshDspchTmrHndl, _rfrshDspchPrd, portMAX_DELAY);	//Starts the timer if it was stopped
+			else if(!xTimerIsTimerActive(_rfrshDspchTmrHndl))
+				xTimerStart(_rfrshDspchTmrHndl, portMAX_DELAY);
+		}
+	}
+
+	return result;
+}
+
+bool SevenSegDynamic::begin(TIM_HandleTypeDef &rfrshTmr, const uint32_t &dgtRfrshUs){
+	bool result {false};
+	if(!_dspBuffPtr || _rfrshDspchd || _rfrshHwTmrPtr)
+		return result;
+	taskENTER_CRITICAL();
+	for(uint8_t i{0}; i < _isrDspsQtyMax; ++i){
+		if(!_isrDspsLst[i]){
+			_isrDspsLst[i] = this;
+			_rfrshHwTmrPtr = &rfrshTmr;
+			result = true;
+			break;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if(result){
+		SevenSegDispHw::begin();
+		dspBffrCntntChng();
+		taskENTER_CRITICAL();
+		_dgtRfrshPrdUs = dgtRfrshUs? dgtRfrshUs : static_cast<uint32_t>(1000000UL / (100UL * _rfrshSlotsQty));
+		_bcmUnitUs = _bcmUnitCalc(_bcmBits);
+		_isrDgtPos = 0;
+		_bcmBit = 0;
+		taskEXIT_CRITICAL();
+		rfrshTmr.Init.Prescaler = (getTmrClkFrq(rfrshTmr.Instance) / TMR_CNT_CLK_HZ) - 1;	// Prescaled to 1MHz from the timer's kernel clock
+		rfrshTmr.Init.CounterMode = TIM_COUNTERMODE_UP;
+		rfrshTmr.Init.Period = (_bcmBits? _bcmUnitUs : _dgtRfrshPrdUs) - 1;	// The first slot is the digit 0 bit 0 slot
+		rfrshTmr.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+		rfrshTmr.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+		if(!_tmrPrdsVld(rfrshTmr.Instance, _bcmBits, _bcmUnitUs)){
+			result = false;
+		}
+		else if (HAL_TIM_Base_Init(&rfrshTmr) == HAL_OK){
+			HAL_TIM_RegisterCallback(&rfrshTmr, HAL_TIM_PERIOD_ELAPSED_CB_ID, tmrCbRefreshDgt);
+			if(HAL_TIM_Base_Start_IT(&rfrshTmr) != HAL_OK)
+				result = false;
+		}
+		else{
+			result = false;
+		}
+		if(!result){
+			taskENTER_CRITICAL();
+			for(uint8_t i{0}; i < _isrDspsQtyMax; ++i){
+				if(_isrDspsLst[i] == this)
+					_isrDspsLst[i] = nullptr;
+			}
+			_rfrshHwTmrPtr = nullptr;
+			taskEXIT_CRITICAL();
 		}
 	}
 
@@ -152,116 +345,402 @@ bool SevenSegDynamic::begin(const unsigned long int &rfrshFrq){
 
 bool SevenSegDynamic::end() {
     bool result {false};
-    BaseType_t tmrModResult {pdFAIL};
-
-    if(_dspRfrshTmrHndl){   //if the timer still exists and is running, stop and delete
-   	 tmrModResult = xTimerStop(_dspRfrshTmrHndl, portMAX_DELAY);
-   	 if(tmrModResult == pdPASS){
-   		 tmrModResult = xTimerDelete(_dspRfrshTmrHndl, portMAX_DELAY);
-      	 if(tmrModResult == pdPASS){
-				 _dspRfrshTmrHndl = NULL;
-				 result = true;
-      	 }
+    bool dspchEmpty {false};
+    TickType_t prvDspchPrd{_rfrshDspchPrd};
+
+    if(_rfrshHwTmrPtr){	//Refreshed by a hardware timer interrupt
+   	 HAL_TIM_Base_Stop_IT(_rfrshHwTmrPtr);
+   	 taskENTER_CRITICAL();
+   	 for(uint8_t i{0}; i < _isrDspsQtyMax; ++i){
+   		 if(_isrDspsLst[i] == this)
+   			 _isrDspsLst[i] = nullptr;
    	 }
+   	 _rfrshHwTmrPtr = nullptr;
+   	 taskEXIT_CRITICAL();
+   	 result = true;
+    }
+    if(_rfrshDspchd){   //Refreshed by the dispatcher, unregister, the last display stops the dispatcher timer
+   	 taskENTER_CRITICAL();
+   	 for(uint8_t i{0}; i < _rfrshDspchQty; ++i){
+   		 if(_rfrshDspchLst[i] == this){
+   			 for(uint8_t j{i}; j < (_rfrshDspchQty - 1); ++j)
+   				 _rfrshDspchLst[j] = _rfrshDspchLst[j + 1];
+   			 _rfrshDspchLst[--_rfrshDspchQty] = nullptr;
+   			 break;
+   		 }
+   	 }
+   	 _rfrshDspchd = false;
+   	 _rfrshDspchUpd();
+   	 dspchEmpty = (_rfrshDspchQty == 0);
+   	 taskEXIT_CRITICAL();
+   	 if(dspchEmpty)
+   		 xTimerStop(_rfrshDspchTmrHndl, portMAX_DELAY);
+   	 else if(_rfrshDspchPrd != prvDspchPrd)
+   		 xTimerChangePeriod(_rfrshDspchTmrHndl, _rfrshDspchPrd, portMAX_DELAY);
+   	 result = true;
     }
 
     return result;
 }
 
-void SevenSegDynamic::tmrCbRefreshDyn(TimerHandle_t rfrshTmrCbArg){
-	SevenSegDynamic* argObj = (SevenSegDynamic*)pvTimerGetTimerID(rfrshTmrCbArg);
-   //Timer Callback to keep the display lit by calling the display's refresh() method
-	argObj -> refresh();
+void SevenSegDynamic::_rfrshDspchUpd(){
+	SevenSegDynamic* dspsLst[_rfrshDspchQtyMax]{};
+	const void* psBuses[_rfrshDspchQtyMax]{};
+	uint8_t psBusesQty{0};
+	uint8_t ordrdQty{0};
+	bool busUsed{false};
+	TickType_t gcdRmndr{0};
+	TickType_t gcdAux{0};
+
+	//Greatest common divisor of the registered displays periods, so each display's period is a whole quantity of dispatcher periods, and each display's servicing period in dispatcher periods
+	_rfrshDspchPrd = 0;
+	for(uint8_t i{0}; i < _rfrshDspchQty; ++i){
+		gcdRmndr = _rfrshDspchLst[i]->_rfrshTcks;
+		while(gcdRmndr){
+			gcdAux = _rfrshDspchPrd % gcdRmndr;
+			_rfrshDspchPrd = gcdRmndr;
+			gcdRmndr = gcdAux;
+		}
+	}
+	for(uint8_t i{0}; i < _rfrshDspchQty; ++i){
+		_rfrshDspchLst[i]->_rfrshDvdr = _rfrshDspchLst[i]->_rfrshTcks / _rfrshDspchPrd;
+		_rfrshDspchLst[i]->_rfrshDvdrCnt = 1;
+	}
+	//Interleave the buses: each pass over the registration ordered displays takes at most one display per bus
+	for(uint8_t i{0}; i < _rfrshDspchQty; ++i)
+		dspsLst[i] = _rfrshDspchLst[i];
+	while(ordrdQty < _rfrshDspchQty){
+		psBusesQty = 0;
+		for(uint8_t i{0}; i < _rfrshDspchQty; ++i){
+			if(dspsLst[i]){
+				const void* busId{dspsLst[i]->rfrshBusId()};
+				busUsed = false;
+				for(uint8_t j{0}; j < psBusesQty; ++j){
+					if(busId && (psBuses[j] == busId)){
+						busUsed = true;
+						break;
+					}
+				}
+				if(!busUsed){
+					psBuses[psBusesQty++] = busId;
+					_rfrshDspchLst[ordrdQty++] = dspsLst[i];
+					dspsLst[i] = nullptr;
+				}
+			}
+		}
+	}
 
-    return;
+	return;
 }
 
-//============================================================> Class methods separator
+void SevenSegDynamic::tmrCbRfrshDspch(TimerHandle_t rfrshTmrCbArg){
+	//Timer Callback to keep the displays lit, lighting the next digit of each display due
+	//The scheduler is kept suspended for the whole walk, so no task ends or destroys a display being serviced. The registered displays list is only changed by tasks, in begin() and end()
+	vTaskSuspendAll();
+	for(uint8_t i{0}; i < _rfrshDspchQty; ++i){
+		SevenSegDynamic* dspPtr{_rfrshDspchLst[i]};
+		if(--dspPtr->_rfrshDvdrCnt == 0){
+#if SEVENSEG_RFRSH_STATS
+			uint32_t strtCyc{statsCycCnt()};
+#endif
+			dspPtr->_rfrshDvdrCnt = dspPtr->_rfrshDvdr;
+#if SEVENSEG_TRACE
+			dspPtr->trace(trcRfrshSlot, dspPtr->_firstRefreshed);
+#endif
+			dspPtr->refreshSlot(dspPtr->_firstRefreshed, 0);
+#if SEVENSEG_RFRSH_STATS
+			dspPtr->_rfrshStatsUpd(strtCyc, true, dspPtr->_firstRefreshed == 0, dspPtr->_rfrshDvdr * _rfrshDspchPrd * portTICK_PERIOD_MS * 1000);
+#endif
+			if(++dspPtr->_firstRefreshed == dspPtr->_rfrshSlotsQty)
+				dspPtr->_firstRefreshed = 0;
+		}
+	}
+	xTaskResumeAll();
 
-SevenSegDynHC595::SevenSegDynHC595(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode)
-:SevenSegDynamic(ioPins, dspDigits, commAnode), _sclk{ioPins[_sclkArgPos]}, _rclk{ioPins[_rclkArgPos]}, _dio{ioPins[_dioArgPos]}
-{
-	//Set the declared GPIO pins
-	 setGPIOPinAsOutput(_sclk);
-	 setGPIOPinAsOutput(_rclk);
-	 setGPIOPinAsOutput(_dio);
+	return;
+}
 
-	 HAL_GPIO_WritePin(_rclk.portId, _rclk.pinNum, GPIO_PIN_SET); // _rclk (data latched) will be lowered to let data in
-	 HAL_GPIO_WritePin(_sclk.portId, _sclk.pinNum, GPIO_PIN_RESET);	//The _sclk  must start lowered (as data will be taken at rise flank)
+void SevenSegDynamic::tmrCbRefreshDgt(TIM_HandleTypeDef* htim){
+	//Hardware timer interrupt callback, lights the next digit (or digit brightness slot) of the display driven by the timer
+	for(uint8_t i{0}; i < _isrDspsQtyMax; ++i){
+		SevenSegDynamic* dspPtr{_isrDspsLst[i]};
+		if(dspPtr && (dspPtr->_rfrshHwTmrPtr == htim)){
+			dspPtr->_isrRfrshNxt();
+			break;
+		}
+	}
+
+	return;
 }
 
-SevenSegDynHC595::~SevenSegDynHC595(){}
+void SevenSegDynamic::_isrRfrshNxt(){
+#if SEVENSEG_RFRSH_STATS
+	uint32_t strtCyc{statsCycCnt()};
+	bool dgtStrt{_bcmBit == 0};
+	bool frmStrt{dgtStrt && (_isrDgtPos == 0)};
+#endif
+
+	if(_bcmBits){
+#if SEVENSEG_TRACE
+		trace(trcRfrshSlot, (uint16_t(1) << (_bcmBit + 8)) | _isrDgtPos);
+#endif
+		refreshSlot(_isrDgtPos, uint8_t(1) << _bcmBit);
+#if SEVENSEG_RFRSH_STATS
+		_rfrshStatsUpd(strtCyc, dgtStrt, frmStrt, _bcmUnitUs * ((uint32_t(1) << _bcmBits) - 1));
+#endif
+		if(++_bcmBit == _bcmBits){
+			_bcmBit = 0;
+			if(++_isrDgtPos == _rfrshSlotsQty)
+				_isrDgtPos = 0;
+		}
+		//The auto-reload is preloaded, the value written sets the length of the slot started by the next interrupt
+		__HAL_TIM_SET_AUTORELOAD(_rfrshHwTmrPtr, (_bcmUnitUs << _bcmBit) - 1);
+	}
+	else{
+#if SEVENSEG_TRACE
+		trace(trcRfrshSlot, _isrDgtPos);
+#endif
+		refreshSlot(_isrDgtPos, 0);
+#if SEVENSEG_RFRSH_STATS
+		_rfrshStatsUpd(strtCyc, true, frmStrt, _dgtRfrshPrdUs);
+#endif
+		if(++_isrDgtPos == _rfrshSlotsQty)
+			_isrDgtPos = 0;
+	}
 
-bool SevenSegDynHC595::begin(const unsigned long int &rfrshFrq){
-	bool result {false};
-   BaseType_t tmrModResult {pdFAIL};
-   TickType_t tmrRfrshFrqInTcks{0};
+	return;
+}
 
-	//Verify if the timer service was attached by checking if the Timer Handle is valid (also verify the timer was started)
-	if (!_svnSgDynTmrHndl){
-		if (rfrshFrq)	//Calculate the Timer Period
-			tmrRfrshFrqInTcks = pdMS_TO_TICKS(rfrshFrq);
-		else
-			tmrRfrshFrqInTcks = pdMS_TO_TICKS(static_cast<int>(1000/(30 * _dspDigitsQty)));
-		//Create a valid unique Name for identifying the timer created for this Dynamic Display
-		std::string _svnSgDynSerNumStr{ "00" + std::to_string((int)_dspHwInstNbr) };
-		_svnSgDynSerNumStr = _svnSgDynSerNumStr.substr(_svnSgDynSerNumStr.length() - 2, 2);
-		std::string _svnSgDynRfrshTmrName {"DynDsp"};
-		_svnSgDynRfrshTmrName = _svnSgDynRfrshTmrName + _svnSgDynSerNumStr + "rfrsh_tmr";
-		//Initialize the Display refresh timer. Considering each digit to be refreshed at 30 Hz in turn, the freq might be (Max qty of digits * 30Hz)
-		_dspRfrshTmrHndl = xTimerCreate(
-							_svnSgDynRfrshTmrName.c_str(),
-							tmrRfrshFrqInTcks,	//Timer period
-							pdTRUE,  //Autoreload
-							this,   //TimerID, data to be passed to the callback function
-							tmrCbRefreshDyn  //Callback function
-		);
-		if((_dspRfrshTmrHndl != NULL) && (!xTimerIsTimerActive(_dspRfrshTmrHndl))){
-			tmrModResult = xTimerStart(_dspRfrshTmrHndl, portMAX_DELAY);
-			if (tmrModResult == pdPASS)
-				result = true;
+void SevenSegDynamic::refreshSlot(const uint8_t &slot, const uint8_t &bcmBitMsk){
+	uint16_t rfrshWrd{*(_rfrshFrmPtr + slot)};
+
+	if(bcmBitMsk && !(*(_dgtBrghtnssPtr + slot) & bcmBitMsk))
+		rfrshWrd = _rfrshOffWrd;
+	refreshWrd(rfrshWrd);
+
+	return;
+}
+
+#if SEVENSEG_RFRSH_STATS
+void SevenSegDynamic::_rfrshStatsUpd(const uint32_t &strtCyc, const bool &dgtStrt, const bool &frmStrt, const uint32_t &nmnlPrdUs){
+	uint32_t slotCyc{statsCycCnt() - strtCyc};
+	uint32_t intrvlCyc{0};
+	uint32_t nmnlCyc{nmnlPrdUs * statsCycPerUs()};
+	uint32_t dvtnCyc{0};
+	uint8_t bin{0};
+
+	++_statsSlotsCnt;
+	_statsSlotsCycSum += slotCyc;
+	if(slotCyc > _statsSlotCycMax)
+		_statsSlotCycMax = slotCyc;
+	if(dgtStrt){
+		if(_statsStmpd){
+			intrvlCyc = strtCyc - _statsLstStrtCyc;	//Unsigned arithmetic, the counter wrap around is harmless
+			if((_statsIntrvlsCnt == 0) || (intrvlCyc < _statsIntrvlMinCyc))
+				_statsIntrvlMinCyc = intrvlCyc;
+			if(intrvlCyc > _statsIntrvlMaxCyc)
+				_statsIntrvlMaxCyc = intrvlCyc;
+			++_statsIntrvlsCnt;
+			_statsIntrvlsCycSum += intrvlCyc;
+			dvtnCyc = (intrvlCyc > nmnlCyc)? (intrvlCyc - nmnlCyc) : (nmnlCyc - intrvlCyc);
+			while((bin < (RFRSH_JTTR_BINS - 1)) && ((uint64_t(dvtnCyc) * 100) >= (uint64_t(nmnlCyc) * RFRSH_JTTR_BINS_PCNT[bin])))
+				++bin;
+			++_statsJttrHstgrm[bin];
 		}
+		_statsLstStrtCyc = strtCyc;
+		_statsStmpd = true;
+		if(frmStrt)
+			++_statsFrmsCnt;
+	}
+
+	return;
+}
+
+rfrshStats_t SevenSegDynamic::getRfrshStats(){
+	rfrshStats_t result{};
+	uint32_t cycPerUs{statsCycPerUs()};
+	uint64_t intrvlsCycSum{0};
+	uint32_t intrvlsCnt{0};
+	uint64_t slotsCycSum{0};
+	uint32_t slotsCnt{0};
+
+	taskENTER_CRITICAL();
+	result.frmsCnt = _statsFrmsCnt;
+	result.intrvlMinUs = _statsIntrvlMinCyc / cycPerUs;
+	result.intrvlMaxUs = _statsIntrvlMaxCyc / cycPerUs;
+	for(uint8_t i{0}; i < RFRSH_JTTR_BINS; ++i)
+		result.jttrHstgrm[i] = _statsJttrHstgrm[i];
+	result.slotCycMax = _statsSlotCycMax;
+	intrvlsCycSum = _statsIntrvlsCycSum;
+	intrvlsCnt = _statsIntrvlsCnt;
+	slotsCycSum = _statsSlotsCycSum;
+	slotsCnt = _statsSlotsCnt;
+	taskEXIT_CRITICAL();
+
+	if(intrvlsCnt){
+		result.intrvlMeanUs = static_cast<uint32_t>(intrvlsCycSum / intrvlsCnt / cycPerUs);
+		//The frames per second from the digits refreshed in the measured time
+		result.fps = (float(intrvlsCnt) / float(_rfrshSlotsQty)) * (float(cycPerUs) * 1000000.0f) / float(intrvlsCycSum);
 	}
+	if(slotsCnt)
+		result.slotCycMean = static_cast<uint32_t>(slotsCycSum / slotsCnt);
 
 	return result;
 }
 
-bool SevenSegDynHC595::end() {
-    bool result {false};
-    BaseType_t tmrModResult {pdFAIL};
-
-    if(_dspRfrshTmrHndl){   //if the timer still exists and is running, stop and delete
-   	 tmrModResult = xTimerStop(_dspRfrshTmrHndl, portMAX_DELAY);
-   	 if(tmrModResult == pdPASS){
-   		 tmrModResult = xTimerDelete(_dspRfrshTmrHndl, portMAX_DELAY);
-      	 if(tmrModResult == pdPASS){
-				 _dspRfrshTmrHndl = NULL;
-				 result = true;
-      	 }
-   	 }
-    }
+void SevenSegDynamic::resetRfrshStats(){
+	taskENTER_CRITICAL();
+	_statsStmpd = false;
+	_statsFrmsCnt = 0;
+	_statsIntrvlsCnt = 0;
+	_statsIntrvlsCycSum = 0;
+	_statsIntrvlMinCyc = 0;
+	_statsIntrvlMaxCyc = 0;
+	for(uint8_t i{0}; i < RFRSH_JTTR_BINS; ++i)
+		_statsJttrHstgrm[i] = 0;
+	_statsSlotsCnt = 0;
+	_statsSlotsCycSum = 0;
+	_statsSlotCycMax = 0;
+	taskEXIT_CRITICAL();
 
-    return result;
+	return;
 }
+#endif
 
-void SevenSegDynHC595::refresh(){
-   uint8_t tmpDigToSend{0};
-   uint8_t tmpPosToSend{0};
+uint32_t SevenSegDynamic::_bcmUnitCalc(const uint8_t &bcmBits){
+	//The digit period is split in (2^bits - 1) time units, 0 when the brightness control is disabled
 
-    for (int i {0}; i < _dspDigitsQty; i++){
-        tmpDigToSend = *(_dspBuffPtr + ((i + _firstRefreshed) % _dspDigitsQty));
-        tmpPosToSend = uint8_t(1) << *(_digitPosPtr + ((i + _firstRefreshed) % _dspDigitsQty));
-//        send(tmpDigToSend, uint8_t(1) << *(_digitPosPtr + ((i + _firstRefreshed) % _dspDigitsQty)));
-        send(tmpDigToSend, tmpPosToSend);
-    }
-    ++_firstRefreshed;
-    if (_firstRefreshed == _dspDigitsQty)
-        _firstRefreshed = 0;
+	return bcmBits? (_dgtRfrshPrdUs / ((uint32_t(1) << bcmBits) - 1)) : 0;
+}
 
-    return;
+bool SevenSegDynamic::_tmrPrdsVld(const TIM_TypeDef* tmrInst, const uint8_t &bcmBits, const uint32_t &bcmUnitUs){
+	//Every period programmed must last at least 2 timer counts (an auto-reload value of 0 stalls the counter), and the longest one must fit the timer's auto-reload register
+	uint32_t prdMin{bcmBits? bcmUnitUs : _dgtRfrshPrdUs};
+	uint64_t prdMax{bcmBits? (uint64_t(bcmUnitUs) << (bcmBits - 1)) : uint64_t(_dgtRfrshPrdUs)};
+
+	return (prdMin >= 2) && (prdMax <= (uint64_t(getTmrArrMax(tmrInst)) + 1));
+}
+
+uint8_t SevenSegDynamic::getBrghtnssLvls(){
+
+	return _brghtnssLvls;
+}
+
+uint8_t SevenSegDynamic::getDgtBrghtnss(const uint8_t &dgtPos){
+	uint8_t result{0};
+
+	if(dgtPos < _dspDigitsQty)
+		result = *(_dgtBrghtnssPtr + dgtPos);
+
+	return result;
+}
+
+bool SevenSegDynamic::setBrghtnss(const uint8_t &newBrghtnss){
+	bool result{false};
+
+	if(newBrghtnss < _brghtnssLvls){
+		for(uint8_t i{0}; i < _dspDigitsQty; ++i)
+			*(_dgtBrghtnssPtr + i) = newBrghtnss;
+		result = true;
+	}
+
+	return result;
+}
+
+bool SevenSegDynamic::setBrghtnssBits(const uint8_t &newBrghtnssBits){
+	bool result{false};
+	uint32_t bcmUnitUs{0};
+
+	if(newBrghtnssBits <= _bcmBitsMax){
+		taskENTER_CRITICAL();
+		bcmUnitUs = _bcmUnitCalc(newBrghtnssBits);
+		if(!_rfrshHwTmrPtr || _tmrPrdsVld(_rfrshHwTmrPtr->Instance, newBrghtnssBits, bcmUnitUs)){	//The periods are checked again by begin(TIM_HandleTypeDef&, const uint32_t&)
+			_bcmBits = newBrghtnssBits;
+			_brghtnssLvls = _bcmBits? static_cast<uint8_t>(uint8_t(1) << _bcmBits) : 0;
+			for(uint8_t i{0}; i < _dspDigitsQty; ++i)
+				*(_dgtBrghtnssPtr + i) = _bcmBits? _brghtnssLvls - 1 : 0;
+			_bcmBit = 0;
+			_bcmUnitUs = bcmUnitUs;
+			if(_rfrshHwTmrPtr)	//Restarts with the next digit first slot
+				__HAL_TIM_SET_AUTORELOAD(_rfrshHwTmrPtr, (_bcmBits? _bcmUnitUs : _dgtRfrshPrdUs) - 1);
+			result = true;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+	return result;
+}
+
+bool SevenSegDynamic::setDgtBrghtnss(const uint8_t &dgtPos, const uint8_t &newBrghtnss){
+	bool result{false};
+
+	if((dgtPos < _dspDigitsQty) && (newBrghtnss < _brghtnssLvls)){
+		*(_dgtBrghtnssPtr + dgtPos) = newBrghtnss;
+		result = true;
+	}
+
+	return result;
+}
+
+//============================================================> Class methods separator
+
+SevenSegDynHC595::SevenSegDynHC595(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode)
+:SevenSegDynamic(ioPins, dspDigits, commAnode), _sclk{ioPins[_sclkArgPos]}, _rclk{ioPins[_rclkArgPos]}, _dio{ioPins[_dioArgPos]}
+{
+	//Set the declared GPIO pins
+	 setGPIOPinAsOutput(_sclk, false, HC595_GPIO_SPEED);
+	 setGPIOPinAsOutput(_rclk, false, HC595_GPIO_SPEED);
+	 setGPIOPinAsOutput(_dio, false, HC595_GPIO_SPEED);
+
+	 HAL_GPIO_WritePin(_rclk.portId, _rclk.pinNum, GPIO_PIN_SET); // _rclk (data latched) will be lowered to let data in
+	 HAL_GPIO_WritePin(_sclk.portId, _sclk.pinNum, GPIO_PIN_RESET);	//The _sclk  must start lowered (as data will be taken at rise flank)
+
+	 //BSRR register words for the fast GPIO path, the pin set in the low half word, reset in the high half word
+	 _sclkDioSamePort = (_sclk.portId == _dio.portId);
+	 _sclkSetBsrr = _sclk.pinNum;
+	 _sclkRstBsrr = uint32_t(_sclk.pinNum) << 16;
+	 _dioSetBsrr = _dio.pinNum;
+	 _dioRstBsrr = uint32_t(_dio.pinNum) << 16;
+	 if(_sclkDioSamePort){	//The SCLK is lowered in the same write that presents the DIO bit
+		 _dioSetBsrr |= _sclkRstBsrr;
+		 _dioRstBsrr |= _sclkRstBsrr;
+	 }
+	 _rclkSetBsrr = _rclk.pinNum;
+	 _rclkRstBsrr = uint32_t(_rclk.pinNum) << 16;
+}
+
+SevenSegDynHC595::~SevenSegDynHC595(){
+	end();
+}
+
+const void* SevenSegDynHC595::rfrshBusId(){
+
+	return _sclk.portId;
+}
+
+void SevenSegDynHC595::refreshWrd(const uint16_t &rfrshWrd){
+	send(uint8_t(rfrshWrd >> 8), uint8_t(rfrshWrd));
+
+	return;
 }
 
 void SevenSegDynHC595::send(uint8_t content){
+#if SEVENSEG_FAST_GPIO
+	GPIO_TypeDef* dioPort{_dio.portId};
+	GPIO_TypeDef* sclkPort{_sclk.portId};
+
+	for (int i {7}; i >= 0; i--){   //Send each of the 8 bits representing the character
+		dioPort->BSRR = (content & 0x80)? _dioSetBsrr : _dioRstBsrr;	//Data presented, SCLK lowered too if sharing the port
+		gpioWrWait(dioPort);	//DIO setup time and SCLK low pulse width
+		sclkPort->BSRR = _sclkSetBsrr;	//Rising edge to accept data presented
+		gpioWrWait(sclkPort);	//SCLK high pulse width
+		content <<= 1;
+		if(!_sclkDioSamePort)
+			sclkPort->BSRR = _sclkRstBsrr; //Lower back for next bit to be presented
+	}
+	sclkPort->BSRR = _sclkRstBsrr;
+	gpioWrWait(sclkPort);	//SCLK low before the RCLK rise or the next byte
+#else
 	bool prevPnLvl {false};
 
 	HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, GPIO_PIN_RESET);	//Ensuring starting state of the data out pin
@@ -275,128 +754,447 @@ void SevenSegDynHC595::send(uint8_t content){
 		content <<= 1;
 		HAL_GPIO_WritePin(_sclk.portId, _sclk.pinNum, GPIO_PIN_RESET); //Lower back for next bit to be presented
 	}
+#endif
+#if SEVENSEG_STATS
+	++_hwStats.bytesSent;
+	_hwStats.bitsSent += 8;
+#endif
 
 	return;
 }
 
 void SevenSegDynHC595::send(const uint8_t &segments, const uint8_t &port){
 
+#if SEVENSEG_FAST_GPIO
+	_rclk.portId->BSRR = _rclkRstBsrr;	//Set the shift register to accept data
+	send(segments);
+	send(port);
+	_rclk.portId->BSRR = _rclkSetBsrr;	//Set the shift register to show latched data
+#else
 	HAL_GPIO_WritePin(_rclk.portId, _rclk.pinNum, GPIO_PIN_RESET);	//Set the shift register to accept data
 	send(segments);
 	send(port);
 	HAL_GPIO_WritePin(_rclk.portId, _rclk.pinNum, GPIO_PIN_SET);	//Set the shift register to show latched data
+#endif
 
    return;
 }
 
-void SevenSegDynHC595::tmrCbRefreshDyn(TimerHandle_t rfrshTmrCbArg){
-	SevenSegDynHC595* argObj = (SevenSegDynHC595*)pvTimerGetTimerID(rfrshTmrCbArg);
-   //Timer Callback to keep the display lit by calling the display's refresh() method
-	argObj -> refresh();
+void SevenSegDynHC595::sendChain(const uint8_t* bytesPtr, const uint8_t &bytesQty){
 
-    return;
+#if SEVENSEG_FAST_GPIO
+	_rclk.portId->BSRR = _rclkRstBsrr;	//Set the shift registers to accept data
+	for(uint8_t i{0}; i < bytesQty; ++i)
+		send(*(bytesPtr + i));
+	_rclk.portId->BSRR = _rclkSetBsrr;	//Set the shift registers to show latched data
+#else
+	HAL_GPIO_WritePin(_rclk.portId, _rclk.pinNum, GPIO_PIN_RESET);	//Set the shift registers to accept data
+	for(uint8_t i{0}; i < bytesQty; ++i)
+		send(*(bytesPtr + i));
+	HAL_GPIO_WritePin(_rclk.portId, _rclk.pinNum, GPIO_PIN_SET);	//Set the shift registers to show latched data
+#endif
+
+   return;
+}
+
+//============================================================> Class methods separator
+
+SevenSegDynHC595Chain::SevenSegDynHC595Chain(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode, uint8_t chnMdls, uint8_t mdlPortBytes)
+:SevenSegDynHC595(ioPins, dspDigits, commAnode), _chnMdlsQty{static_cast<uint8_t>(chnMdls? chnMdls : 1)}, _mdlPortBytes{static_cast<uint8_t>((mdlPortBytes == 2)? 2 : 1)}
+{
+	if((_dspDigitsQty == 0) || (_dspDigitsQty > _dspDigitsQtyMax))	//The display is left unbuilt, begin() fails
+		return;
+	_rfrshSlotsQty = (_dspDigitsQty + _chnMdlsQty - 1) / _chnMdlsQty;
+	if(_rfrshSlotsQty > 8)	//A single port selection register can't select the ports beyond the 8th, the modules need two
+		_mdlPortBytes = 2;
+	_slotBytes = 1 + _mdlPortBytes;
+	_chnFrmPtr = new uint8_t[_rfrshSlotsQty * _chnMdlsQty * _slotBytes]{};
+	_chnSlotBffrPtr = new uint8_t[_chnMdlsQty * _slotBytes]{};
+	_chnBffrPosPtr = new uint8_t[_dspDigitsQty]{};
+	//Until the contents are set every slot shifts all the segments off and no port selected
+	for(int i{0}; i < (_rfrshSlotsQty * _chnMdlsQty); ++i)
+		*(_chnFrmPtr + (i * _slotBytes)) = 0xFF ^ _segsPlrtyMsk;
+}
+
+SevenSegDynHC595Chain::~SevenSegDynHC595Chain()
+{
+	end();
+	delete [] _chnBffrPosPtr;
+	delete [] _chnSlotBffrPtr;
+	delete [] _chnFrmPtr;
+}
+
+bool SevenSegDynHC595Chain::begin(const unsigned long int &rfrshFrq){
+
+	return _chnFrmPtr && SevenSegDynHC595::begin(rfrshFrq);
+}
+
+bool SevenSegDynHC595Chain::begin(TIM_HandleTypeDef &rfrshTmr, const uint32_t &dgtRfrshUs){
+
+	return _chnFrmPtr && SevenSegDynHC595::begin(rfrshTmr, dgtRfrshUs);
+}
+
+void SevenSegDynHC595Chain::dspBffrCntntChng(const uint16_t &chngdDgtsMsk){
+	uint8_t hwPos{0};
+	uint8_t mdl{0};
+	uint8_t slot{0};
+	uint16_t portBits{0};
+	uint8_t* mdlBytesPtr{nullptr};
+
+#if SEVENSEG_STATS
+	++_hwStats.ntfctnsCnt;
+#endif
+#if SEVENSEG_TRACE
+	trace(trcBffrChng, chngdDgtsMsk);
+#endif
+	if(_dspBuffPtr && _chnFrmPtr){
+		for(uint8_t i{0}; i < _dspDigitsQty; ++i){
+			if(chngdDgtsMsk & (uint16_t(1) << i)){
+				hwPos = *(_digitPosPtr + i);
+				mdl = hwPos / _rfrshSlotsQty;
+				slot = hwPos % _rfrshSlotsQty;
+				portBits = uint16_t(1) << slot;
+				//The farthest module of the chain is shifted first
+				mdlBytesPtr = _chnFrmPtr + (slot * _chnMdlsQty + (_chnMdlsQty - 1 - mdl)) * _slotBytes;
+				*mdlBytesPtr = *(_dspBuffPtr + i) ^ _segsPlrtyMsk;
+				if(_mdlPortBytes == 2)
+					*(mdlBytesPtr + 1) = uint8_t(portBits >> 8);
+				*(mdlBytesPtr + _mdlPortBytes) = uint8_t(portBits);
+				*(_chnBffrPosPtr + hwPos) = i;
+			}
+		}
+	}
+
+	return;
+}
+
+void SevenSegDynHC595Chain::refreshSlot(const uint8_t &slot, const uint8_t &bcmBitMsk){
+	const uint8_t* slotBytesPtr{_chnFrmPtr + (slot * _chnMdlsQty * _slotBytes)};
+	uint8_t hwPos{0};
+
+	if(bcmBitMsk){	//The modules whose digit is off in this brightness slot shift the segments off and no port selected
+		for(uint8_t mdl{0}; mdl < _chnMdlsQty; ++mdl){
+			uint8_t* mdlBytesPtr{_chnSlotBffrPtr + (_chnMdlsQty - 1 - mdl) * _slotBytes};
+			const uint8_t* frmBytesPtr{slotBytesPtr + (_chnMdlsQty - 1 - mdl) * _slotBytes};
+			hwPos = mdl * _rfrshSlotsQty + slot;
+			if((hwPos < _dspDigitsQty) && (*(_dgtBrghtnssPtr + *(_chnBffrPosPtr + hwPos)) & bcmBitMsk)){
+				for(uint8_t j{0}; j < _slotBytes; ++j)
+					*(mdlBytesPtr + j) = *(frmBytesPtr + j);
+			}
+			else{
+				*mdlBytesPtr = 0xFF ^ _segsPlrtyMsk;
+				for(uint8_t j{1}; j < _slotBytes; ++j)
+					*(mdlBytesPtr + j) = 0x00;
+			}
+		}
+		slotBytesPtr = _chnSlotBffrPtr;
+	}
+	sendChain(slotBytesPtr, _chnMdlsQty * _slotBytes);
+
+	return;
+}
+
+//============================================================> Class methods separator
+
+SevenSegDynHC595Spi::SevenSegDynHC595Spi(SPI_HandleTypeDef* spiHndlPtr, const gpioPinId_t &rclk, uint8_t dspDigits, bool commAnode)
+:SevenSegDynamic(nullptr, dspDigits, commAnode), _spiHndlPtr{spiHndlPtr}, _rclk{rclk}
+{
+	setGPIOPinAsOutput(_rclk);
+	HAL_GPIO_WritePin(_rclk.portId, _rclk.pinNum, GPIO_PIN_SET); // _rclk (data latched) will be lowered to let data in
+
+	taskENTER_CRITICAL();
+	for(uint8_t i{0}; i < _spiDspsQtyMax; ++i){
+		if(!_spiDspsLst[i]){
+			_spiDspsLst[i] = this;
+			_spiRgstrd = true;
+			break;
+		}
+	}
+	taskEXIT_CRITICAL();
+	if(_spiRgstrd)	//An unregistered display would never be found by the callback, it's left unable to begin()
+		HAL_SPI_RegisterCallback(_spiHndlPtr, HAL_SPI_TX_COMPLETE_CB_ID, spiCbTxCplt);
+}
+
+SevenSegDynHC595Spi::~SevenSegDynHC595Spi()
+{
+	end();
+	taskENTER_CRITICAL();
+	for(uint8_t i{0}; i < _spiDspsQtyMax; ++i){
+		if(_spiDspsLst[i] == this)
+			_spiDspsLst[i] = nullptr;
+	}
+	taskEXIT_CRITICAL();
+}
+
+bool SevenSegDynHC595Spi::begin(const unsigned long int &rfrshFrq){
+
+	return _spiRgstrd && SevenSegDynamic::begin(rfrshFrq);
+}
+
+bool SevenSegDynHC595Spi::begin(TIM_HandleTypeDef &rfrshTmr, const uint32_t &dgtRfrshUs){
+
+	return _spiRgstrd && SevenSegDynamic::begin(rfrshTmr, dgtRfrshUs);
+}
+
+const void* SevenSegDynHC595Spi::rfrshBusId(){
+
+	return _spiHndlPtr;
+}
+
+bool SevenSegDynHC595Spi::getSpiBusy(){
+
+	return _spiDgtsPndng != 0;
+}
+
+void SevenSegDynHC595Spi::refreshWrd(const uint16_t &rfrshWrd){
+	//The word is skipped if the previous one is still being transmitted
+	if(_spiDgtsPndng == 0){
+		_spiDgtsPndng = 1;
+		_spiTxWrd(rfrshWrd);
+	}
+
+	return;
+}
+
+void SevenSegDynHC595Spi::_spiTxWrd(const uint16_t &rfrshWrd){
+	_spiTxBffr[0] = uint8_t(rfrshWrd >> 8);
+	_spiTxBffr[1] = uint8_t(rfrshWrd);
+	HAL_GPIO_WritePin(_rclk.portId, _rclk.pinNum, GPIO_PIN_RESET);	//Set the shift register to accept data
+	if(HAL_SPI_Transmit_DMA(_spiHndlPtr, _spiTxBffr, 2) != HAL_OK){	//The refresh is dropped
+		HAL_GPIO_WritePin(_rclk.portId, _rclk.pinNum, GPIO_PIN_SET);
+		_spiDgtsPndng = 0;
+	}
+#if SEVENSEG_STATS
+	else{
+		_hwStats.bytesSent += 2;
+		_hwStats.bitsSent += 16;
+	}
+#endif
+
+	return;
+}
+
+void SevenSegDynHC595Spi::spiCbTxCplt(SPI_HandleTypeDef* hspi){
+	for(uint8_t i{0}; i < _spiDspsQtyMax; ++i){
+		SevenSegDynHC595Spi* dspPtr{_spiDspsLst[i]};
+		if(dspPtr && (dspPtr->_spiHndlPtr == hspi)){
+			HAL_GPIO_WritePin(dspPtr->_rclk.portId, dspPtr->_rclk.pinNum, GPIO_PIN_SET);	//Set the shift register to show latched data
+			dspPtr->_spiDgtsPndng = 0;
+			break;
+		}
+	}
+
+	return;
 }
 
 //============================================================> Class methods separator
 
 SevenSegStatic::SevenSegStatic(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode)
-:SevenSegDispHw(ioPins, dspDigits, commAnode)
+:SevenSegDispHw(ioPins, dspDigits, commAnode), _txFrmBffr{new uint8_t[dspDigits]}
 {
+	for (int i{0}; i < dspDigits; ++i)
+		*(_txFrmBffr + i) = 0xFF;	//Blank frame, in the font encoding
 }
 
 SevenSegStatic::~SevenSegStatic()
 {
+	delete [] _txFrmBffr;
+	_txFrmBffr = nullptr;
+}
+
+void SevenSegStatic::dspBffrCntntChng(const uint16_t &chngdDgtsMsk){
+#if SEVENSEG_STATS
+	++_hwStats.ntfctnsCnt;
+#endif
+#if SEVENSEG_TRACE
+	trace(trcBffrChng, chngdDgtsMsk);
+#endif
+	if(_dspBuffPtr && chngdDgtsMsk){
+		taskENTER_CRITICAL();
+		if(_txFrmPndng)	//The previous frame didn't reach the wire, it's coalesced in the new one
+			++_txFrmsDrpd;
+		for (int i{0}; i < _dspDigitsQty; ++i)
+			*(_txFrmBffr + i) = *(_dspBuffPtr + i);
+		_txFrmChngdMsk |= chngdDgtsMsk;
+		_txFrmPndng = true;
+		_txFrmPstd();
+		taskEXIT_CRITICAL();
+	}
+
+	return;
+}
+
+void SevenSegStatic::_txFrmDscrd(){
+	_txFrmChngdMsk = 0;
+	_txFrmPndng = false;
+
+	return;
+}
+
+void SevenSegStatic::_txFrmSent(){
+	++_txFrmsSent;
+
+	return;
+}
+
+bool SevenSegStatic::_txFrmTake(uint16_t &chngdDgtsMsk){
+	//Must be invoked from the transmission interrupt or with it masked (critical section)
+	bool result{_txFrmPndng};
+
+	chngdDgtsMsk = _txFrmChngdMsk;
+	_txFrmDscrd();
+
+	return result;
+}
+
+uint8_t SevenSegStatic::getTxFrmsPndng(){
+
+	return _txFrmPndng? 1 : 0;
+}
+
+uint32_t SevenSegStatic::getTxFrmsDrpd(){
+
+	return _txFrmsDrpd;
+}
+
+uint32_t SevenSegStatic::getTxFrmsSent(){
+
+	return _txFrmsSent;
+}
+
+void SevenSegStatic::resetTxFrmsCntrs(){
+	taskENTER_CRITICAL();
+	_txFrmsDrpd = 0;
+	_txFrmsSent = 0;
+	taskEXIT_CRITICAL();
+
+	return;
 }
 
 //============================================================> Class methods separator
 
 SevenSegTM163X::SevenSegTM163X(gpioPinId_t* ioPins, uint8_t dspDigits)
-:SevenSegStatic(ioPins, dspDigits, true)
+:SevenSegStatic(ioPins, dspDigits, false)	//The TM163X chips turn on a segment by setting it's bit, as a common cathode display
 {
 	 _clk = ioPins[_clkArgPos];
 	 _dio = ioPins[_dioArgPos];
+	 //Worst case message: Command1 frame + one (address + data) frame per digit + Command3 frame, each frame preceded by it's length
+	 _mssgBffr = new uint8_t[2 + (3 * dspDigits) + 2];
 
 	setGPIOPinAsOutput(_clk);	//Setting pin directions
-	setGPIOPinAsOutput(_dio);
+	setGPIOPinAsOutput(_dio, true);	//Open drain to release the line for the chip's ACK
+	HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_SET);	//Idle bus: both lines high
+	HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, GPIO_PIN_SET);
 }
 
 SevenSegTM163X::~SevenSegTM163X()
 {
+	taskENTER_CRITICAL();
+	end();
+	if(_busPtr)
+		_busPtr->detach(this);
+	if(_txActvInstPtr == this){	//The transmission in progress can't be gracefully ended, the bus is released and the next display is started
+		HAL_TIM_Base_Stop_IT(&_txTM163xTmr);
+		HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_SET);
+		HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, GPIO_PIN_SET);
+		_txStts = txIdle;
+		_txActvInstPtr = nullptr;
+		_txStrtNxt();
+	}
+	taskEXIT_CRITICAL();
+	delete [] _mssgBffr;
+	_mssgBffr = nullptr;
 }
 
 bool SevenSegTM163X::begin(TIM_HandleTypeDef &newTxTM163xTmr){
-	bool result{false};
+	bool result{true};
 	/*
 	 * As TM163X use a non standard I2C-like communications protocol, the begin method must do
-	 * - Create a Timer interrupt to produce the CLK speed of the communications
-	 * - Start the Timer int
-	 * - Send a turn On command using the turnOn() method
-	 * - Clear the display (test if needed)
-	 * - Stop the interrupt Timer
+	 * - Create a Timer interrupt to produce the CLK speed of the communications, it's interrupts are enabled only while transmitting
+	 * - Send a turn On command and the display's data buffer contents
 	 */
+	if(!_txBgn){
+		if(!_usTmrUsrs){
+			//Timer parameters configuration
+			//---------------------------------------------------------------------
+			TIM_OC_InitTypeDef sConfigOC = {0};
+
+			_txTM163xTmr.Instance = TIM11;	//Adress of the TIMER11, must be variable for different timers use
+			_txTM163xTmr.Init.Prescaler = (getTmrClkFrq(_txTM163xTmr.Instance) / TMR_CNT_CLK_HZ) - 1;	// Prescaled to 1MHz from the timer's kernel clock
+			_txTM163xTmr.Init.CounterMode = TIM_COUNTERMODE_UP;
+			_txTM163xTmr.Init.Period = 10-1;
+			_txTM163xTmr.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+			_txTM163xTmr.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+			if (HAL_TIM_Base_Init(&_txTM163xTmr) != HAL_OK)
+			{
+				Error_Handler();
+			}
+			if (HAL_TIM_OC_Init(&_txTM163xTmr) != HAL_OK)
+			{
+				Error_Handler();
+			}
+			sConfigOC.OCMode = TIM_OCMODE_TIMING;
+			sConfigOC.Pulse = 0;
+			sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+			sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+			if (HAL_TIM_OC_ConfigChannel(&_txTM163xTmr, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
+			{
+				Error_Handler();
+			}
+			//---------------------------------------------------------------------
+			HAL_TIM_RegisterCallback(&_txTM163xTmr, HAL_TIM_PERIOD_ELAPSED_CB_ID, tmrCbTx);	//Associates the callback with the interrupt source
+			/*HAL_StatusTypeDef HAL_TIM_RegisterCallback(TIM_HandleTypeDef *htim, HAL_TIM_CallbackIDTypeDef CallbackID, pTIM_CallbackTypeDef pCallback);
+			 *                                                            -------                           ----------                       ---------
+			 *                                                               |                                  |                                 |
+			 *                                                               |                                  |                                 --> Pointer to the TIM callback function, the declaration of the function must respect the function pointer as follows: typedef void (*pTIM_CallbackTypeDef)(TIM_HandleTypeDef *htim)
+			 *                                                               |                                  ------------------------------------> Enum defining the Interrupt trigger event for this timer: HAL_TIM_OC_DELAY_ELAPSED_CB_ID = 0x14U // TIM Output Compare Delay Elapsed Callback ID
+			 *                                                               -----------------------------------------------------------------------> TIM_HandleTypeDef reference to the timer
+			*/
+		}
+		++_usTmrUsrs;
+		_txBgn = true;
+		_dspCtrlChng = true;
+		dspBffrCntntChng();
+		taskENTER_CRITICAL();
+		_txFrmPstd();	//Queues the display control command on it's own when no data buffer contents were posted
+		taskEXIT_CRITICAL();
+	}
 
-	//Timer parameters configuration
-	//---------------------------------------------------------------------
-	TIM_OC_InitTypeDef sConfigOC = {0};
-
-	_txTM163xTmr.Instance = TIM11;	//Adress of the TIMER11, must be variable for different timers use
-	_txTM163xTmr.Init.Prescaler = 84-1;	// Prescaled to 1MHz, must be variable to generate that clockspeed for any MCU
-	_txTM163xTmr.Init.CounterMode = TIM_COUNTERMODE_UP;
-	_txTM163xTmr.Init.Period = 10-1;
-	_txTM163xTmr.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
-	_txTM163xTmr.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
-	if (HAL_TIM_Base_Init(&_txTM163xTmr) != HAL_OK)
-	{
-		Error_Handler();
-	}
-	if (HAL_TIM_OC_Init(&_txTM163xTmr) != HAL_OK)
-	{
-		Error_Handler();
-	}
-	sConfigOC.OCMode = TIM_OCMODE_TIMING;
-	sConfigOC.Pulse = 0;
-	sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
-	sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
-	if (HAL_TIM_OC_ConfigChannel(&_txTM163xTmr, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
-	{
-		Error_Handler();
-	}
-	//---------------------------------------------------------------------
-	  HAL_TIM_RegisterCallback(&_txTM163xTmr, HAL_TIM_PERIOD_ELAPSED_CB_ID, txTM163xTmrCB);	//Associates the callback with the interrupt source
-	/*HAL_StatusTypeDef HAL_TIM_RegisterCallback(TIM_HandleTypeDef *htim, HAL_TIM_CallbackIDTypeDef CallbackID, pTIM_CallbackTypeDef pCallback);
-	 *                                                            -------                           ----------                       ---------
-	 *                                                               |                                  |                                 |
-	 *                                                               |                                  |                                 --> Pointer to the TIM callback function, the declaration of the function must respect the function pointer as follows: typedef void (*pTIM_CallbackTypeDef)(TIM_HandleTypeDef *htim)
-	 *                                                               |                                  ------------------------------------> Enum defining the Interrupt trigger event for this timer: HAL_TIM_OC_DELAY_ELAPSED_CB_ID = 0x14U // TIM Output Compare Delay Elapsed Callback ID
-	 *                                                               -----------------------------------------------------------------------> TIM_HandleTypeDef reference to the timer
-	*/
-  //---------------------------------------------------------------------
-	  HAL_TIM_Base_Start_IT(&_txTM163xTmr);
+	return result;
+}
 
+bool SevenSegTM163X::end(){
+	bool result{false};
 
+	taskENTER_CRITICAL();
+	if(_txBgn){
+		if(_txWtng)
+			_txUnqueue();
+		if(_txActv())
+			_txAbrt = true;
+		_txFrmDscrd();
+		_txBgn = false;
+		--_usTmrUsrs;
+		result = true;
+	}
+	taskEXIT_CRITICAL();
 
 	return result;
 }
 
-void SevenSegTM163X::delay10UsTck(const uint32_t &actDelay){
-	uint32_t tckCount{0};
-	timIntFlg = RESET;	// The handmade CLK signal starts low to give the chance to use a "Rising Edge" mechanism
+bool SevenSegTM163X::getTxBusy(){
 
-	do{
-	  if(timIntFlg == SET){
-		  ++tckCount;
-		  timIntFlg = RESET;
-	  }
-	}while (tckCount <= actDelay);
+	return _txActv() || _txWtng;
+}
+
+void SevenSegTM163X::setTxCmpltTskHndl(TaskHandle_t newTxCmpltTskHndl){
+	_txCmpltTskHndl = newTxCmpltTskHndl;
 
 	return;
 }
 
-void SevenSegTM163X::dspBffrCntntChng(){
-	/* If it's low cost confirm the new buffer contents are different from the display content
-	 * Create a message buffer according to the TM1637 I2C modified protocol:
-	 * Invoke the send() method to output the message to the display
-	 * Delete the message buffer
+uint8_t SevenSegTM163X::_bldMssg(const uint16_t &chngdDgtsMsk){
+	/* The message is built from the posted frame according to the TM163X I2C modified protocol when the display's turn to transmit comes, and output frame by frame by the timer interrupt driven state machine:
 	 * >> SOT commands + buffer contents + EOT command
 	 * SOT Commands: Command1 + Command2
 	 * >> - Command1: Mode setup
@@ -405,13 +1203,13 @@ void SevenSegTM163X::dspBffrCntntChng(){
 	 *  --- --- - - ---
 	 *   |   |  | |  |
 	 *   |   |  | |  Data Write to display: 00
-	 *   |   |  | Address auto-increment:  0
+	 *   |   |  | Address auto-increment/fixed:  0/1
 	 *   |   |  Normal/Test mode:         0
 	 *   |   N/C:                       00
 	 *   Data command setting:        01
-	 *                              0b01000000
+	 *                              0b01000X00
 	 *
-	 * >> - Command2: Address command setting, for TM1637 and TM1639 is 0xC0, 6 consecutive addresses for TM1637, 16 for TM1639
+	 * >> - Command2: Address command setting, for TM1637 and TM1639 is 0xC0, 6 consecutive addresses for TM1637, 16 for TM1639. In auto-increment mode one Command2 frame is sent for each run of changed addresses, in fixed address mode for each changed address
 	 * -----------------
 	 * |7|6|5|4|3|2|1|0|
 	 *  --- --- -------
@@ -435,73 +1233,663 @@ void SevenSegTM163X::dspBffrCntntChng(){
 	 *   Display Control:             10
 	 *                              0b1000XXXX
 	 */
+	uint8_t addrBffrPos[MAX_DIGITS_PER_DISPLAY];	// Display address to display's data buffer position translation
+	uint8_t addrData[MAX_DIGITS_PER_DISPLAY]{};
+	uint16_t chngdAddrMsk{0};
+	uint8_t chngdAddrQty{0};
+	uint8_t runsQty{0};
+	uint8_t runsDataQty{0};
+	int lastAddr{-1};
+	bool fxdAddr{false};
+	uint8_t* mssgPtr{_mssgBffr};
+	uint8_t* frmLngthPtr{nullptr};
+
+	for (int addr{0}; addr < _dspDigitsQty; ++addr)
+		addrBffrPos[addr] = 0xFF;
+	for (int i{0}; i < _dspDigitsQty; ++i){
+		addrBffrPos[*(_digitPosPtr + i)] = i;
+		if(chngdDgtsMsk & (uint16_t(1) << i))
+			chngdAddrMsk |= (uint16_t(1) << *(_digitPosPtr + i));
+	}
+	for (int addr{0}; addr < _dspDigitsQty; ++addr)	// Addresses not mapped to a buffer position are kept blank
+		addrData[addr] = ((addrBffrPos[addr] != 0xFF)? *(_txFrmBffr + addrBffrPos[addr]) : 0xFF) ^ _segsPlrtyMsk;
+
+	//Cost of both addressing modes in CLK periods, the Command1 and Command3 frames are common to both and not considered
+	for (int addr{0}; addr < _dspDigitsQty; ++addr){
+		if(chngdAddrMsk & (uint16_t(1) << addr)){
+			++chngdAddrQty;
+			if((lastAddr >= 0) && ((addr - lastAddr - 1) <= TM163X_MAX_MRG_GAP)){
+				runsDataQty += (addr - lastAddr);
+			}
+			else{
+				++runsQty;
+				++runsDataQty;
+			}
+			lastAddr = addr;
+		}
+	}
+	fxdAddr = (chngdAddrQty * (TM163X_FRM_CLKS + 2 * TM163X_BYTE_CLKS)) <= ((runsQty * (TM163X_FRM_CLKS + TM163X_BYTE_CLKS)) + (runsDataQty * TM163X_BYTE_CLKS));
+
+	//Message build as a sequence of frames, each one preceded by it's length in bytes. With no changed addresses only the Command3 frame is sent, if due
+	if(chngdAddrQty){
+		*(mssgPtr++) = 1;
+		*(mssgPtr++) = fxdAddr? TM163X_DATA_CMD_FIXED : TM163X_DATA_CMD_AUTO;
+		lastAddr = -1;
+		for (int addr{0}; addr < _dspDigitsQty; ++addr){
+			if(chngdAddrMsk & (uint16_t(1) << addr)){
+				if(!fxdAddr && (lastAddr >= 0) && ((addr - lastAddr - 1) <= TM163X_MAX_MRG_GAP)){
+					for (int gapAddr{lastAddr + 1}; gapAddr <= addr; ++gapAddr){
+						*(mssgPtr++) = addrData[gapAddr];
+						++(*frmLngthPtr);
+					}
+				}
+				else{
+					frmLngthPtr = mssgPtr++;
+					*frmLngthPtr = 2;
+					*(mssgPtr++) = TM163X_ADDR_CMD | addr;
+					*(mssgPtr++) = addrData[addr];
+				}
+				lastAddr = addr;
+			}
+		}
+	}
+	if(_dspCtrlChng){
+		*(mssgPtr++) = 1;
+		*(mssgPtr++) = TM163X_DSP_CTRL_CMD | (_brghtnss & 0x07);
+		_dspCtrlChng = false;
+	}
+	_mssgBffrLngth = mssgPtr - _mssgBffr;
+
+	return _mssgBffrLngth;
+}
+
+bool SevenSegTM163X::_txLoad(){
+	uint16_t chngdDgtsMsk{0};
+
+	if(!_txFrmTake(chngdDgtsMsk) && !_dspCtrlChng)	//A display control change is sent even with no frame posted
+		return false;
+	if(_txRsndAll){	//The last transmission failed, the chip's display RAM contents are unknown
+		chngdDgtsMsk = static_cast<uint16_t>((uint32_t(1) << _dspDigitsQty) - 1);
+		_dspCtrlChng = true;
+		_txRsndAll = false;
+	}
+	if(!_bldMssg(chngdDgtsMsk))
+		return false;
+	_txStts = txStart;
+	_txStep = 0;
+	_txFrmPos = 0;
+	_txBytePos = 1;
+	_txBitPos = 0;
+	_txAckWtTcks = 0;
+	_txAbrt = false;
+#if SEVENSEG_TRACE
+	trace(trcTmFrmStrt, _mssgBffrLngth);
+#endif
+
+	return true;
+}
+
+bool SevenSegTM163X::_txActv(){
+
+	return (_txActvInstPtr == this) || (_busPtr && (_txActvBusPtr == _busPtr) && (_txStts != txIdle));
+}
+
+void SevenSegTM163X::_txFrmPstd(){
+	if(_txBgn){
+		if(!_txActv() && !_txWtng)
+			_txQueue();
+		_txStrtNxt();
+	}
+
+	return;
+}
+
+void SevenSegTM163X::_txQueue(){
+	_txWtngNxtPtr = nullptr;
+	if(_txWtngTlPtr)
+		_txWtngTlPtr->_txWtngNxtPtr = this;
+	else
+		_txWtngHdPtr = this;
+	_txWtngTlPtr = this;
+	_txWtng = true;
+
+	return;
+}
+
+void SevenSegTM163X::_txUnqueue(){
+	SevenSegTM163X* prvInstPtr{nullptr};
+	SevenSegTM163X* curInstPtr{_txWtngHdPtr};
+
+	while(curInstPtr && (curInstPtr != this)){
+		prvInstPtr = curInstPtr;
+		curInstPtr = curInstPtr->_txWtngNxtPtr;
+	}
+	if(curInstPtr){
+		if(prvInstPtr)
+			prvInstPtr->_txWtngNxtPtr = _txWtngNxtPtr;
+		else
+			_txWtngHdPtr = _txWtngNxtPtr;
+		if(_txWtngTlPtr == this)
+			_txWtngTlPtr = prvInstPtr;
+	}
+	_txWtngNxtPtr = nullptr;
+	_txWtng = false;
+
+	return;
+}
+
+void SevenSegTM163X::_txStrtNxt(){
+	//Must be invoked from the timer interrupt or with it masked (critical section)
+	SevenSegTM163X* nxtInstPtr{nullptr};
+
+	while(!_txActvInstPtr && !_txActvBusPtr && _txWtngHdPtr){
+		nxtInstPtr = _txWtngHdPtr;
+		nxtInstPtr->_txUnqueue();
+		if(nxtInstPtr->_busPtr){	//The displays of a bus group with frames to transmit are started together
+			if(nxtInstPtr->_busPtr->_txLoad(nxtInstPtr))
+				_txActvBusPtr = nxtInstPtr->_busPtr;
+		}
+		else if(nxtInstPtr->_txLoad()){
+			_txActvInstPtr = nxtInstPtr;
+		}
+	}
+	if(_txActvInstPtr || _txActvBusPtr){
+		if(_txTM163xTmr.State == HAL_TIM_STATE_READY)
+			HAL_TIM_Base_Start_IT(&_txTM163xTmr);
+	}
+	else{
+		HAL_TIM_Base_Stop_IT(&_txTM163xTmr);
+	}
+
+	return;
+}
+
+void SevenSegTM163X::tmrCbTx(TIM_HandleTypeDef *htim){
+	if(_txActvBusPtr)
+		_txActvBusPtr->_txTck();
+	else if(_txActvInstPtr)
+		_txActvInstPtr->_txTck();
+
+	return;
+}
+
+void SevenSegTM163X::_txTck(){
+	//Each timer interrupt advances the transmission one step, each CLK level is held for two steps
+	if(_txAbrt && (_txStts != txStop)){
+		_txStts = txStop;
+		_txStep = 0;
+	}
+	switch(_txStts){
+	case txStart:
+		_txStart();
+		break;
+	case txWrByte:
+		_txWrByte();
+		break;
+	case txAsk:
+		_txAsk();
+		break;
+	case txStop:
+		_txStop();
+		break;
+	default:
+		break;
+	}
+
+	return;
+}
+
+void SevenSegTM163X::_txDone(BaseType_t &tskWoken){
+#if SEVENSEG_TRACE
+	trace(trcTmFrmStop, _txAbrt? 1 : 0);
+#endif
+	_txStts = txIdle;
+	if(!_txAbrt)
+		_txFrmSent();
+	if(_txCmpltTskHndl)
+		vTaskNotifyGiveFromISR(_txCmpltTskHndl, &tskWoken);
+	if(_txBgn && (_txFrmPndng || _dspCtrlChng) && !_txWtng)	//Frames posted during the transmission wait for the next turn, a failed transmission is resent with the next frame
+		_txQueue();
+
+	return;
+}
+
+void SevenSegTM163X::_txEnd(){
+	BaseType_t tskWoken{pdFALSE};
+
+	_txActvInstPtr = nullptr;
+	_txDone(tskWoken);
+	_txStrtNxt();
+	portYIELD_FROM_ISR(tskWoken);
 
 	return;
 }
 
 void SevenSegTM163X::_txStart(){
-	HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, GPIO_PIN_SET);
-	delay10UsTck(2);
-	HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, GPIO_PIN_RESET);
+	//Start signal: DIO falls while CLK is high, the idle bus has both lines high
+	if(_txStep == 0){
+		HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, GPIO_PIN_RESET);
+		++_txStep;
+	}
+	else{
+		_txStts = txWrByte;
+		_txStep = 0;
+		_txBitPos = 0;
+	}
+
+	return;
+}
 
+void SevenSegTM163X::_txWrByte(){
+	//Data bits are presented LSB first while CLK is low, and taken by the chip at the CLK rising edge
+	switch(_txStep){
+	case 0:
+		HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_RESET);
+		break;
+	case 1:
+		HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, ((*(_mssgBffr + _txBytePos) >> _txBitPos) & 0x01)? GPIO_PIN_SET : GPIO_PIN_RESET);
+		break;
+	case 2:
+		HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_SET);
+		break;
+	default:
+		break;
+	}
+	if(_txStep < 3){
+		++_txStep;
+	}
+	else{
+		_txStep = 0;
+		if(++_txBitPos == 8){
+			_txStts = txAsk;
+			_txAckWtTcks = 0;
+		}
+	}
 
 	return;
 }
+
 void SevenSegTM163X::_txAsk(){
-	HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_RESET);
-	delay10UsTck(5);
-	while (HAL_GPIO_ReadPin(_dio.portId, _dio.pinNum)){
+	//After the 8th CLK falling edge the DIO line is released and the chip pulls it low until the 9th CLK falling edge
+	switch(_txStep){
+	case 0:
+		HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_RESET);
+		HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, GPIO_PIN_SET);
+		++_txStep;
+		break;
+	case 1:
+		if(HAL_GPIO_ReadPin(_dio.portId, _dio.pinNum) == GPIO_PIN_RESET){
+			HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_SET);
+			++_txStep;
+		}
+		else if(++_txAckWtTcks > TM163X_ACK_TMOUT_TCKS){	//No ACK, the chip's display RAM contents are unknown
+			_txRsndAll = true;
+			_txAbrt = true;
+			_txStts = txStop;
+			_txStep = 0;
+		}
+		break;
+	case 2:
+		++_txStep;
+		break;
+	default:
+		_txStep = 0;
+		++_txBytePos;
+#if SEVENSEG_STATS
+		++_hwStats.bytesSent;
+		_hwStats.bitsSent += TM163X_BYTE_CLKS;
+#endif
+		if(_txBytePos <= (_txFrmPos + *(_mssgBffr + _txFrmPos))){
+			_txStts = txWrByte;
+			_txBitPos = 0;
+		}
+		else{
+			_txStts = txStop;
+		}
+		break;
 	}
-	HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_SET);
-	delay10UsTck(2);
-	HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_RESET);
 
 	return;
 }
+
 void SevenSegTM163X::_txStop(){
-	HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_RESET);
-	delay10UsTck(2);
-	HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, GPIO_PIN_RESET);
-	delay10UsTck(2);
-	HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_SET);
-	delay10UsTck(2);
-	HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, GPIO_PIN_SET);
+	//Stop signal: DIO rises while CLK is high, leaving the bus idle
+	switch(_txStep){
+	case 0:
+		HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_RESET);
+		break;
+	case 1:
+		HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, GPIO_PIN_RESET);
+		break;
+	case 2:
+		HAL_GPIO_WritePin(_clk.portId, _clk.pinNum, GPIO_PIN_SET);
+		break;
+	default:
+		HAL_GPIO_WritePin(_dio.portId, _dio.pinNum, GPIO_PIN_SET);
+		break;
+	}
+	if(_txStep < 3){
+		++_txStep;
+	}
+	else{
+		_txStep = 0;
+#if SEVENSEG_STATS
+		_hwStats.bitsSent += TM163X_FRM_CLKS;
+#endif
+		_txFrmPos += *(_mssgBffr + _txFrmPos) + 1;
+		if(!_txAbrt && (_txFrmPos < _mssgBffrLngth)){
+			_txStts = txStart;
+			_txBytePos = _txFrmPos + 1;
+		}
+		else{
+			_txEnd();
+		}
+	}
 
 	return;
 }
-void SevenSegTM163X::_txWrByte(const uint8_t data){
 
-	return;
+//============================================================> Class methods separator
+
+SevenSegTM163XBus::SevenSegTM163XBus(const gpioPinId_t &clk, GPIO_TypeDef* dioPort)
+:_clk{clk}, _dioPort{dioPort}
+{
 }
 
-void SevenSegTM163X::send(const uint8_t* data, const uint8_t dataQty){
+SevenSegTM163XBus::~SevenSegTM163XBus()
+{
+	taskENTER_CRITICAL();
+	while(_dspsQty)
+		detach(_dspsPtrs[_dspsQty - 1]);
+	if(SevenSegTM163X::_txActvBusPtr == this){
+		SevenSegTM163X::_txActvBusPtr = nullptr;
+		SevenSegTM163X::_txStrtNxt();
+	}
+	taskEXIT_CRITICAL();
+}
 
-	_txStart();
-	for(int i{0}; i < dataQty; i++){
-		_txWrByte(*(data+i));
-		_txAsk();
+bool SevenSegTM163XBus::attach(SevenSegTM163X* dspPtr){
+	bool result{false};
+
+	taskENTER_CRITICAL();
+	if((_dspsQty < _dspsQtyMax) && !dspPtr->_busPtr && !dspPtr->_txActv() &&
+			(dspPtr->_clk.portId == _clk.portId) && (dspPtr->_clk.pinNum == _clk.pinNum) && (dspPtr->_dio.portId == _dioPort)){
+		_dspsPtrs[_dspsQty++] = dspPtr;
+		dspPtr->_busPtr = this;
+		result = true;
+	}
+	taskEXIT_CRITICAL();
+
+	return result;
+}
+
+bool SevenSegTM163XBus::detach(SevenSegTM163X* dspPtr){
+	bool result{false};
+
+	taskENTER_CRITICAL();
+	for(uint8_t i{0}; i < _dspsQty; ++i){
+		if(_dspsPtrs[i] == dspPtr){
+			if(dspPtr->_txActv()){	//The display leaves the transmission in progress, the chip is left waiting for a Start signal
+				dspPtr->_txStts = SevenSegTM163X::txIdle;
+				gpioBsrrWrite(_dioPort, dspPtr->_dio.pinNum);
+			}
+			for(uint8_t j{i}; j < (_dspsQty - 1); ++j)
+				_dspsPtrs[j] = _dspsPtrs[j + 1];
+			--_dspsQty;
+			dspPtr->_busPtr = nullptr;
+			result = true;
+			break;
+		}
 	}
-	_txStop();
+	taskEXIT_CRITICAL();
+
+	return result;
+}
+
+uint8_t SevenSegTM163XBus::getDspsQty(){
+
+	return _dspsQty;
+}
+
+bool SevenSegTM163XBus::_txLoad(SevenSegTM163X* frstDspPtr){
+	//Must be invoked from the timer interrupt or with it masked (critical section)
+	bool result{false};
+
+	for(uint8_t i{0}; i < _dspsQty; ++i){
+		SevenSegTM163X* dspPtr{_dspsPtrs[i]};
+		if(dspPtr->_txWtng)
+			dspPtr->_txUnqueue();
+		if(((dspPtr == frstDspPtr) || (dspPtr->_txBgn && (dspPtr->_txFrmPndng || dspPtr->_dspCtrlChng))) && dspPtr->_txLoad())
+			result = true;
+		else
+			dspPtr->_txStts = SevenSegTM163X::txIdle;
+	}
+	_txStep = 0;
+
+	return result;
+}
+
+void SevenSegTM163XBus::_txTck(){
+	/*
+	 * All the displays of the group share the CLK, and are clocked in 4 steps slots: CLK falls, DIO lines change, CLK rises, DIO lines change
+	 * Each display transmits it's own message as a slots sequence: Start, 8 data bits + ACK for each byte, Stop, and stays idle (DIO high) once done
+	 * The DIO lines changing while CLK is low present data bits, the ones changing while CLK is high signal Start and Stop
+	 */
+	uint32_t dioBsrr{0};
+	uint16_t ackMsk{0};
+	uint16_t dioLvls{0};
+	uint8_t actvQty{0};
+	BaseType_t tskWoken{pdFALSE};
+
+	switch(_txStep){
+	case 0:
+		gpioBsrrWrite(_clk.portId, uint32_t(_clk.pinNum) << 16);
+		break;
+	case 1:
+		for(uint8_t i{0}; i < _dspsQty; ++i){
+			SevenSegTM163X* dspPtr{_dspsPtrs[i]};
+			bool dioLvl{true};	//Start, ACK (line released) and idle
+			if(dspPtr->_txStts == SevenSegTM163X::txWrByte)
+				dioLvl = (*(dspPtr->_mssgBffr + dspPtr->_txBytePos) >> dspPtr->_txBitPos) & 0x01;
+			else if(dspPtr->_txStts == SevenSegTM163X::txStop)
+				dioLvl = false;
+			dioBsrr |= dioLvl? uint32_t(dspPtr->_dio.pinNum) : (uint32_t(dspPtr->_dio.pinNum) << 16);
+		}
+		gpioBsrrWrite(_dioPort, dioBsrr);
+		break;
+	case 2:
+		gpioBsrrWrite(_clk.portId, _clk.pinNum);
+		break;
+	default:
+		for(uint8_t i{0}; i < _dspsQty; ++i){
+			if(_dspsPtrs[i]->_txStts == SevenSegTM163X::txAsk)
+				ackMsk |= _dspsPtrs[i]->_dio.pinNum;
+		}
+		if(ackMsk)
+			dioLvls = gpioIdrRead(_dioPort, ackMsk);
+		for(uint8_t i{0}; i < _dspsQty; ++i){
+			SevenSegTM163X* dspPtr{_dspsPtrs[i]};
+			switch(dspPtr->_txStts){
+			case SevenSegTM163X::txStart:
+				dioBsrr |= uint32_t(dspPtr->_dio.pinNum) << 16;
+				dspPtr->_txStts = SevenSegTM163X::txWrByte;
+				dspPtr->_txBitPos = 0;
+				break;
+			case SevenSegTM163X::txWrByte:
+				if(++dspPtr->_txBitPos == 8)
+					dspPtr->_txStts = SevenSegTM163X::txAsk;
+				break;
+			case SevenSegTM163X::txAsk:
+				if(dioLvls & dspPtr->_dio.pinNum){	//No ACK, the chip's display RAM contents are unknown
+					dspPtr->_txRsndAll = true;
+					dspPtr->_txAbrt = true;
+				}
+				++dspPtr->_txBytePos;
+#if SEVENSEG_STATS
+				++dspPtr->_hwStats.bytesSent;
+				dspPtr->_hwStats.bitsSent += TM163X_BYTE_CLKS;
+#endif
+				if(!dspPtr->_txAbrt && (dspPtr->_txBytePos <= (dspPtr->_txFrmPos + *(dspPtr->_mssgBffr + dspPtr->_txFrmPos)))){
+					dspPtr->_txStts = SevenSegTM163X::txWrByte;
+					dspPtr->_txBitPos = 0;
+				}
+				else{
+					dspPtr->_txStts = SevenSegTM163X::txStop;
+				}
+				break;
+			case SevenSegTM163X::txStop:
+				dioBsrr |= dspPtr->_dio.pinNum;
+#if SEVENSEG_STATS
+				dspPtr->_hwStats.bitsSent += TM163X_FRM_CLKS;
+#endif
+				dspPtr->_txFrmPos += *(dspPtr->_mssgBffr + dspPtr->_txFrmPos) + 1;
+				if(!dspPtr->_txAbrt && (dspPtr->_txFrmPos < dspPtr->_mssgBffrLngth)){
+					dspPtr->_txStts = SevenSegTM163X::txStart;
+					dspPtr->_txBytePos = dspPtr->_txFrmPos + 1;
+				}
+				else{
+					dspPtr->_txDone(tskWoken);
+				}
+				break;
+			default:
+				break;
+			}
+			if(dspPtr->_txAbrt && (dspPtr->_txStts != SevenSegTM163X::txStop) && (dspPtr->_txStts != SevenSegTM163X::txIdle))
+				dspPtr->_txStts = SevenSegTM163X::txStop;
+			if(dspPtr->_txStts != SevenSegTM163X::txIdle)
+				++actvQty;
+		}
+		if(dioBsrr)
+			gpioBsrrWrite(_dioPort, dioBsrr);
+		if(!actvQty){
+			SevenSegTM163X::_txActvBusPtr = nullptr;
+			SevenSegTM163X::_txStrtNxt();
+		}
+		portYIELD_FROM_ISR(tskWoken);
+		break;
+	}
+	_txStep = (_txStep + 1) & 0x03;
 
 	return;
 }
 
 //============================================================> Generic use functions
 
-bool setGPIOPinAsOutput(const gpioPinId_t &outPin){
+bool setGPIOPinAsOutput(const gpioPinId_t &outPin, bool openDrain, const uint32_t &speed){
 	  HAL_GPIO_WritePin(outPin.portId, outPin.pinNum, GPIO_PIN_RESET);
 	  GPIO_InitTypeDef pinInit = {
 			  .Pin = outPin.pinNum,
-			  .Mode = GPIO_MODE_OUTPUT_PP,
+			  .Mode = openDrain? GPIO_MODE_OUTPUT_OD : GPIO_MODE_OUTPUT_PP,
 			  .Pull = GPIO_NOPULL,
-			  .Speed = GPIO_SPEED_FREQ_LOW
+			  .Speed = speed
 	  };
 	  HAL_GPIO_Init(outPin.portId, &pinInit);
 
 	  return true;
 }
 
+void gpioBsrrWrite(GPIO_TypeDef* portId, const uint32_t &bsrrVal){
+	//Sets the pins in the low half word and resets the pins in the high half word of bsrrVal with a single register write
+#if SEVENSEG_FAST_GPIO
+	portId->BSRR = bsrrVal;
+#else
+	if(bsrrVal >> 16)
+		HAL_GPIO_WritePin(portId, static_cast<uint16_t>(bsrrVal >> 16), GPIO_PIN_RESET);
+	if(bsrrVal & 0xFFFF)
+		HAL_GPIO_WritePin(portId, static_cast<uint16_t>(bsrrVal & 0xFFFF), GPIO_PIN_SET);
+#endif
+
+	return;
+}
+
+void gpioWrWait(GPIO_TypeDef* portId){
+	//Holds the pins levels last written: each ODR read-back completes once the previous register write reached the pins, and takes at least 2 HCLK cycles
+	for(uint8_t i{0}; i < SEVENSEG_FAST_GPIO_RDS; ++i)
+		(void)portId->ODR;
+
+	return;
+}
+
+uint16_t gpioIdrRead(GPIO_TypeDef* portId, const uint16_t &pinsMsk){
+	//Reads the level of the pins in pinsMsk with a single register read
+#if SEVENSEG_FAST_GPIO
+
+	return static_cast<uint16_t>(portId->IDR) & pinsMsk;
+#else
+	uint16_t result{0};
+
+	for(uint8_t pinPos{0}; pinPos < 16; ++pinPos){
+		if((pinsMsk & (uint16_t(1) << pinPos)) && (HAL_GPIO_ReadPin(portId, uint16_t(1) << pinPos) == GPIO_PIN_SET))
+			result |= (uint16_t(1) << pinPos);
+	}
+
+	return result;
+#endif
+}
+
+uint32_t getTmrClkFrq(const TIM_TypeDef* tmrInst){
+	//The timers kernel clock is their APB bus clock, doubled when the bus prescaler is not 1 (with the RCC DCKCFGR TIMPRE bit cleared, it's reset value, on the devices having it). The APB2 timers are TIM1, TIM8, TIM9, TIM10 and TIM11, the rest are on the APB1
+	RCC_ClkInitTypeDef clkInit{};
+	uint32_t flashLtncy{0};
+	bool onApb2{(tmrInst == TIM1) || (tmrInst == TIM9) || (tmrInst == TIM10) || (tmrInst == TIM11)};
+	uint32_t apbClkFrq{0};
+
+#ifdef TIM8
+	onApb2 = onApb2 || (tmrInst == TIM8);
+#endif
+	HAL_RCC_GetClockConfig(&clkInit, &flashLtncy);
+	if(onApb2){
+		apbClkFrq = HAL_RCC_GetPCLK2Freq();
+		if(clkInit.APB2CLKDivider != RCC_HCLK_DIV1)
+			apbClkFrq *= 2;
+	}
+	else{
+		apbClkFrq = HAL_RCC_GetPCLK1Freq();
+		if(clkInit.APB1CLKDivider != RCC_HCLK_DIV1)
+			apbClkFrq *= 2;
+	}
+
+	return apbClkFrq;
+}
+
+uint32_t getTmrArrMax(const TIM_TypeDef* tmrInst){
+	//TIM2 and TIM5 have 32 bits counters, the rest 16 bits ones
+
+	return ((tmrInst == TIM2) || (tmrInst == TIM5))? 0xFFFFFFFFUL : 0xFFFFUL;
+}
+
+#if SEVENSEG_CYC_CNT
+void statsCycCntInit(){
+	//Enables the DWT cycle counter, the host stand-in build uses the std::chrono steady clock instead
+#if !SEVENSEG_HOST_STANDIN
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+	return;
+}
+
+uint32_t statsCycCnt(){
+#if SEVENSEG_HOST_STANDIN
+
+	return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#else
+
+	return DWT->CYCCNT;
+#endif
+}
+
+uint32_t statsCycPerUs(){
+#if SEVENSEG_HOST_STANDIN
+
+	return 1000;	//The host counter counts nanoseconds
+#else
+
+	return SystemCoreClock / 1000000;
+#endif
+}
+#endif
+
 bool setGPIOPinAsInput(const gpioPinId_t &inPin){
 
 	  HAL_GPIO_WritePin(inPin.portId, inPin.pinNum, GPIO_PIN_RESET);
@@ -528,27 +1916,6 @@ bool setUsTmrInt(){	//Set a timer interrupt of 10 Us for timebase for synchronou
 	return result;
 }
 
-void delay10UsTck(const uint32_t &actDelay){
-	uint32_t tckCount{0};
-	timIntFlg = RESET;	// The "hand-made" CLK signal starts low to give the chance to use a "Rising Edge" mechanism
-
-	do{
-	  if(timIntFlg == SET){
-		  ++tckCount;
-		  timIntFlg = RESET;
-	  }
-	}while (tckCount <= actDelay);
-
-	return;
-}
-
-void txTM163xTmrCB(TIM_HandleTypeDef *htim)
-{
-	timIntFlg = SET;
-
-	return;
-}
-
 void Error_Handler(void)
 {
   /* USER CODE BEGIN Error_Handler_Debug */
@@ -44,6 +44,9 @@
 	#ifndef STM32F4xx_HAL_TIM_H
 		#include "stm32f4xx_hal_tim.h"
 	#endif
+	#ifndef __STM32F4xx_HAL_SPI_H
+		#include "stm32f4xx_hal_spi.h"
+	#endif
 
 #endif
 
@@ -51,6 +54,34 @@
 //===========================>> Previous lines included for developing purposes, corresponding headers must be provided for the production platform/s
 
 
+//===========================>> BEGIN Library build options
+// SEVENSEG_FAST_GPIO timing: the 74HC595 lines are configured at GPIO_SPEED_FREQ_HIGH, and each line change is held by SEVENSEG_FAST_GPIO_RDS read-backs of the port's ODR register. Each read-back completes once the previous register write reached the pins and takes at least 2 HCLK cycles, so the DIO setup and the SCLK high and low pulses last at least (2 * SEVENSEG_FAST_GPIO_RDS + 1) HCLK cycles: 42 ns at 168 MHz with the default 3 read-backs. Raise it for faster cores, or for a 74HC595 slower at the supply voltage used than the ~40 ns data setup and SCLK pulse width usual at 3.3 V
+#ifndef SEVENSEG_FAST_GPIO
+	#define SEVENSEG_FAST_GPIO 1	// Multi-pin outputs written directly to the GPIO BSRR register, set to 0 to use the HAL_GPIO_WritePin() calls instead
+#endif
+#ifndef SEVENSEG_FAST_GPIO_RDS
+	#define SEVENSEG_FAST_GPIO_RDS 3	// GPIO ODR read-backs holding each 74HC595 line change with SEVENSEG_FAST_GPIO set, see above
+#endif
+#ifndef SEVENSEG_STATS
+	#define SEVENSEG_STATS 0	// Per display performance counters, set to 1 to build the getStats() and resetStats() methods of SevenSegDisplays and the hardware classes
+#endif
+#ifndef SEVENSEG_RFRSH_STATS
+	#define SEVENSEG_RFRSH_STATS 0	// Dynamic displays refresh timing instrumentation, set to 1 to build SevenSegDynamic::getRfrshStats(). Measured with the DWT cycle counter, std::chrono on the host stand-in build
+#endif
+#ifndef SEVENSEG_TRACE
+	#define SEVENSEG_TRACE 0	// Timestamped events trace ring buffer per hardware display, set to 1 to build SevenSegDispHw::trace() and getTrcBffrPtr(), see extras/host/trace for the dump decoder
+#endif
+#ifndef SEVENSEG_TRACE_LEN
+	#define SEVENSEG_TRACE_LEN 64	// Trace ring buffer entries per hardware display, must be a power of 2
+#endif
+#define SEVENSEG_CYC_CNT (SEVENSEG_STATS || SEVENSEG_RFRSH_STATS || SEVENSEG_TRACE)	// The cycle counter helpers are built for any of the instrumentation options
+//===========================>> END Library build options
+
+#if SEVENSEG_TRACE
+	#include <atomic>
+	static_assert((SEVENSEG_TRACE_LEN > 0) && !(SEVENSEG_TRACE_LEN & (SEVENSEG_TRACE_LEN - 1)), "SEVENSEG_TRACE_LEN must be a power of 2");
+#endif
+
 //===========================>> BEGIN libraries used to avoid CMSIS wrappers
 #include "FreeRTOS.h"
 #include "task.h"
@@ -74,17 +105,95 @@
 		uint16_t pinNum;	/**< The number of pin represented as a one bit set binary with the set bit position indicating the pin number*/
 	};
 #endif	//GPIOPINID_T
+
+#if SEVENSEG_STATS
+	/**
+	 * @brief Hardware display performance counters, see SevenSegDispHw::getStats()
+	 *
+	 * @struct dspHwStats_t
+	 */
+	struct dspHwStats_t{
+		uint32_t ntfctnsCnt;	/**< Display's data buffer change notifications received (dspBffrCntntChng() invocations)*/
+		uint32_t bytesSent;	/**< Bytes pushed to the display bus*/
+		uint32_t bitsSent;	/**< Clock periods driven on the display bus, including the protocol overhead clocks (i.e. the TM163X ACK clocks)*/
+	};
+#endif
+
+#if SEVENSEG_TRACE
+	/**
+	 * @brief Trace events identification, the meaning of the trcEvt_t::arg value is indicated for each event
+	 *
+	 * @enum trcEvtId_t
+	 */
+	enum trcEvtId_t: uint8_t{
+		trcNone = 0,	/**< Unused entry*/
+		trcPrintBgn,	/**< SevenSegDisplays print started, arg: trcPrintArg_t print kind*/
+		trcPrintEnd,	/**< SevenSegDisplays print finished, arg: 1 displayed, 0 rejected*/
+		trcBffrChng,	/**< dspBffrCntntChng() notification received, arg: changed digits mask*/
+		trcRfrshSlot,	/**< Dynamic display refresh slot lit, arg: slot number in the low byte, BCM bit mask in the high byte*/
+		trcTmFrmStrt,	/**< TM163X message transmission started, arg: message length in bytes*/
+		trcTmFrmStop,	/**< TM163X message transmission finished, arg: 1 aborted (no ACK), 0 sent*/
+		trcBlinkTgl,	/**< Blinking stage switched, arg: 1 turn-On stage started, 0 turn-Off stage started*/
+		trcWaitTgl	/**< Waiting animation updated, arg: wait characters shown*/
+	};
+	/**
+	 * @brief trcPrintBgn event argument values
+	 *
+	 * @enum trcPrintArg_t
+	 */
+	enum trcPrintArg_t: uint16_t{
+		trcPrintTxt = 0,
+		trcPrintInt,
+		trcPrintDbl,
+		trcPrintFxd
+	};
+	/**
+	 * @brief Trace ring buffer entry, see SevenSegDispHw::trace()
+	 *
+	 * @struct trcEvt_t
+	 */
+	struct trcEvt_t{
+		uint32_t seqNum;	/**< Sequence number, shared by all the displays' traces, 0 for an unused or half written entry*/
+		uint32_t tmStmp;	/**< statsCycCnt() value when the event was recorded*/
+		uint8_t evtId;	/**< trcEvtId_t event identification*/
+		uint8_t dspHwInstNbr;	/**< Recording hardware display instance number*/
+		uint16_t arg;	/**< Event dependent argument*/
+	};
+	static_assert(sizeof(trcEvt_t) == 12, "trcEvt_t is dumped as raw 12 bytes entries");
+#endif
+
+#if SEVENSEG_RFRSH_STATS
+	const uint8_t RFRSH_JTTR_BINS{8};	// Refresh jitter histogram bins quantity
+	/**
+	 * @brief Dynamic display refresh timing statistics, see SevenSegDynamic::getRfrshStats()
+	 *
+	 * The intervals are measured between the starts of consecutive digits refreshing. The jitter histogram bins count the intervals by their deviation from the nominal digit period: under 1%, 2%, 5%, 10%, 25%, 50%, 100% and 100% or more.
+	 *
+	 * @struct rfrshStats_t
+	 */
+	struct rfrshStats_t{
+		float fps;	/**< Achieved frames (whole display refreshes) per second*/
+		uint32_t frmsCnt;	/**< Frames started since the statistics reset*/
+		uint32_t intrvlMinUs;	/**< Minimum digit refresh interval, in microseconds*/
+		uint32_t intrvlMaxUs;	/**< Maximum digit refresh interval, in microseconds*/
+		uint32_t intrvlMeanUs;	/**< Mean digit refresh interval, in microseconds*/
+		uint32_t jttrHstgrm[RFRSH_JTTR_BINS];	/**< Digit refresh intervals histogram by deviation from the nominal period*/
+		uint32_t slotCycMean;	/**< Mean cycles spent outputting a refresh slot (nanoseconds on the host stand-in build)*/
+		uint32_t slotCycMax;	/**< Maximum cycles spent outputting a refresh slot (nanoseconds on the host stand-in build)*/
+	};
+#endif
 //===========================>> END User type definitions
 
 //===========================>> BEGIN General use function prototypes
 uint8_t singleBitPosNum(uint16_t mask);
-void delay10UsTck(const uint32_t &actDelay);
+#if SEVENSEG_CYC_CNT
+void statsCycCntInit();	// Enables the cycle counter used by the statistics
+uint32_t statsCycCnt();	// DWT cycle counter, nanoseconds of the std::chrono steady clock on the host stand-in build
+uint32_t statsCycPerUs();
+#endif
 void User_TIMPeriodElapsedCallback(TIM_HandleTypeDef *htim);	// Defining the TM163X Timer Register CB function
 
 //===========================>> END General use function prototypes
-//===========================>> BEGIN (Global) static variables, the use must be reduced to minimum if not completely avoided
-static FlagStatus timIntFlg {RESET};
-//===========================>> END (Global) static variables, the use must be reduced to minimum if not completely avoided
 //============================================================> Class declarations separator
 
 /**
@@ -97,16 +206,27 @@ static FlagStatus timIntFlg {RESET};
  */
 class SevenSegDispHw{
     static uint8_t _dspHwSerialNum;
+#if SEVENSEG_TRACE
+    static std::atomic<uint32_t> _trcSeqNum;
+#endif
 protected:
     gpioPinId_t* _ioPins{};
     uint8_t* _digitPosPtr{nullptr};
     uint8_t _dspDigitsQty{}; //Display size in digits
     const uint8_t _dspDigitsQtyMax{}; // Maximum display size in digits, hardware dependent
-    bool _commAnode {true}; //SevenSegDisplays objects will retrieve this info to build the right segments for each character
+    bool _commAnode {true};
+    uint8_t _segsPlrtyMsk {0x00}; //XORed to the buffer contents when output, as the buffer holds the font (common anode) encoding: 0x00 for common anode, 0xFF for common cathode displays
 
     uint8_t _brghtnssLvls{0};
     uint8_t* _dspBuffPtr{nullptr};
     uint8_t _dspHwInstNbr{0};
+#if SEVENSEG_STATS
+    dspHwStats_t _hwStats{};
+#endif
+#if SEVENSEG_TRACE
+    std::atomic<uint32_t> _trcHd{0};
+    trcEvt_t _trcBffr[SEVENSEG_TRACE_LEN]{};
+#endif
 
 	 virtual void send(uint8_t* digitsBuffer){};
 	 virtual void send(const uint8_t &segments, const uint8_t &port){};
@@ -150,9 +270,19 @@ public:
      *
      * The method is invoked every time the display's data buffer contents change. This mechanism implementation avoids the need of periodically checking the display's data buffer for changes. The standard invocation of this method is done by the SevenSegDisplays class methods that modify the display's data buffer contents (print(), write(), blink(), wait() and others).
      *
-     * @note The dynamic technology displays usually don't have internal buffers and need constant reading of the display buffer to refresh the displaying content. For this kind of displays this method is unneeded, so it might be not implementation for those sub-clases, or might be implemented as an empty method.
+     * @note The dynamic technology displays usually don't have internal buffers and need constant reading of the display buffer to refresh the displaying content. For this kind of displays this method is used to rebuild the precompiled refresh frame, see SevenSegDynamic.
+     *
+     * This version of the method considers all the display's digits changed, see dspBffrCntntChng(const uint16_t).
+     */
+    void dspBffrCntntChng();
+    /**
+     * @brief Loads the hardware display driver's internal buffer with the changed display's data buffer contents.
+     *
+     * The SevenSegDisplays class methods invoke this method once for each logical update of the display's data buffer (a whole print(), clear(), blinking stage switch, etc.), indicating which digits changed, so the hardware classes might send only the changed contents to the display driver.
+     *
+     * @param chngdDgtsMsk Changed digits mask, the bit n set indicates the display's data buffer position n changed.
      */
-    virtual void dspBffrCntntChng(){};
+    virtual void dspBffrCntntChng(const uint16_t &chngdDgtsMsk){};
     /**
      * @brief Stops the timer and/or services needed to keep the display updated
      *
@@ -175,7 +305,7 @@ public:
     /**
      * @brief Gets the pointer to the display's data buffer
      *
-     * The display's data buffer is the array of unsigned short int (byte) that holds the value to be exhibited in each display's port.
+     * The display's data buffer is the array of unsigned short int (byte) that holds the value to be exhibited in each display's port. The values are held in the font encoding (the common anode encoding, a segment is lit when it's bit is reset) independently of the display wiring scheme, the hardware classes apply the display polarity when the values are output.
      *
      * @return A pointer to the display's data buffer.
      */
@@ -186,6 +316,30 @@ public:
      * @return The display's available display ports.
      */
     uint8_t getDspDigits();
+#if SEVENSEG_STATS
+    /**
+     * @brief Gets the hardware display performance counters
+     *
+     * Built only when SEVENSEG_STATS is set to 1.
+     *
+     * @return The counters accumulated since the object instantiation or the last resetStats().
+     */
+    dspHwStats_t getStats();
+    /**
+     * @brief Clears the hardware display performance counters
+     */
+    void resetStats();
+#endif
+#if SEVENSEG_TRACE
+    /**
+     * @brief Gets the pointer to the display's trace ring buffer
+     *
+     * The buffer holds SEVENSEG_TRACE_LEN trcEvt_t entries, the oldest ones being overwritten. It's meant to be dumped as is (i.e. through a debugger memory dump, or sent as raw bytes through a serial port) and decoded by the extras/host/trace decoder, which orders the entries by their sequence number. Built only when SEVENSEG_TRACE is set to 1.
+     *
+     * @return A pointer to the first element of the trace ring buffer.
+     */
+    const trcEvt_t* getTrcBffrPtr();
+#endif
     /**
      * @brief Sets a display ports sorting order.
      *
@@ -196,6 +350,8 @@ public:
      * @retval true: All of the elements of the array were in the accepted range. The change was performed
      * @retval false: At least one of the values of the array parameter is out of range. The change wasn't performed.
      *
+     * @note When the change is performed all the display's digits are considered changed, and dspBffrCntntChng() is invoked.
+     *
      * @note Each value in the array passed as argument will be checked against the _dspDigits value to ensure that they are all in the range acceptable, 0 <= value <= _dspDigits - 1. If one of the values is out of the valid range no change will be done. Please note that no checking will be done to ensure all of the array values are different. A repeated value will be accepted, leading to unexpected display behavior due to superimposing digits and not including digits.
      */
     bool setDigitsOrder(uint8_t* newOrderPtr);
@@ -211,6 +367,17 @@ public:
      * - Checking the legitimacy of the pointer address.
      */
     void setDspBuffPtr(uint8_t* newDspBuffPtr);
+#if SEVENSEG_TRACE
+    /**
+     * @brief Records an event in the display's trace ring buffer
+     *
+     * The method is interrupt safe and wait-free: each invocation claims it's own buffer entry with an atomic increment, and marks it valid by writing the sequence number last, so a task preempted while recording by an interrupt recording for the same display is never blocked nor corrupts the interrupt's entry. Built only when SEVENSEG_TRACE is set to 1.
+     *
+     * @param evtId Event identification, a trcEvtId_t value.
+     * @param arg Event dependent argument, see trcEvtId_t.
+     */
+    void trace(const uint8_t &evtId, const uint16_t &arg = 0);
+#endif
     /**
      * @brief Keeps the dynamic type displays running by redisplaying the content of each display port.
      *
@@ -232,13 +399,63 @@ public:
  * @class SevenSegDynamic
  */
 class SevenSegDynamic: public SevenSegDispHw{
+private:
+	static const uint8_t _isrDspsQtyMax{4};
+	static SevenSegDynamic* _isrDspsLst[_isrDspsQtyMax];
+
+	static const uint8_t _bcmBitsMax{7};
+	static const uint8_t _rfrshDspchQtyMax{8};
+	static SevenSegDynamic* _rfrshDspchLst[_rfrshDspchQtyMax];
+	static uint8_t _rfrshDspchQty;
+	static TimerHandle_t _rfrshDspchTmrHndl;
+#if configSUPPORT_STATIC_ALLOCATION
+	static StaticTimer_t _rfrshDspchTmrBffr;
+#endif
+	static TickType_t _rfrshDspchPrd;
+
+	uint8_t _bcmBits{0};
+	uint8_t _bcmBit{0};
+	uint32_t _bcmUnitUs{0};
+	uint32_t _dgtRfrshPrdUs{0};
+
+	bool _rfrshDspchd{false};
+	TickType_t _rfrshTcks{0};
+	TickType_t _rfrshDvdr{1};
+	TickType_t _rfrshDvdrCnt{1};
+
+#if SEVENSEG_RFRSH_STATS
+	uint32_t _statsLstStrtCyc{0};
+	bool _statsStmpd{false};
+	uint32_t _statsFrmsCnt{0};
+	uint32_t _statsIntrvlsCnt{0};
+	uint64_t _statsIntrvlsCycSum{0};
+	uint32_t _statsIntrvlMinCyc{0};
+	uint32_t _statsIntrvlMaxCyc{0};
+	uint32_t _statsJttrHstgrm[RFRSH_JTTR_BINS]{};
+	uint32_t _statsSlotsCnt{0};
+	uint64_t _statsSlotsCycSum{0};
+	uint32_t _statsSlotCycMax{0};
+
+	void _rfrshStatsUpd(const uint32_t &strtCyc, const bool &dgtStrt, const bool &frmStrt, const uint32_t &nmnlPrdUs);
+#endif
+	uint32_t _bcmUnitCalc(const uint8_t &bcmBits);
+	bool _tmrPrdsVld(const TIM_TypeDef* tmrInst, const uint8_t &bcmBits, const uint32_t &bcmUnitUs);
+	void _isrRfrshNxt();
+	static void _rfrshDspchUpd();
+	static void tmrCbRefreshDgt(TIM_HandleTypeDef* htim);
+	static void tmrCbRfrshDspch(TimerHandle_t rfrshTmrCbArg);
 protected:
-    TimerHandle_t _dspRfrshTmrHndl{NULL};
     uint8_t _firstRefreshed{0};
-    TimerHandle_t _svnSgDynTmrHndl{NULL};
+    TIM_HandleTypeDef* _rfrshHwTmrPtr{nullptr};
+    uint8_t _isrDgtPos{0};
+    uint16_t* _rfrshFrmPtr{nullptr};	// Precompiled refresh frame, a (segments << 8 | port) word per display's data buffer position
+    uint16_t _rfrshOffWrd{0};	// Refresh word with all the segments off and no port selected
+    uint8_t _rfrshSlotsQty{0};	// Refresh slots per frame, each lighting the digits sharing a port selection
+    uint8_t* _dgtBrghtnssPtr{nullptr};
 
-    virtual void refresh(){};
-    static void tmrCbRefreshDyn(TimerHandle_t rfrshTmrCbArg);
+    virtual const void* rfrshBusId(){return nullptr;};
+    virtual void refreshSlot(const uint8_t &slot, const uint8_t &bcmBitMsk);
+    virtual void refreshWrd(const uint16_t &rfrshWrd){};
 public:
     /**
      * @brief Default class constructor
@@ -256,26 +473,117 @@ public:
      * @brief Virtual class destructor
      */
     virtual ~SevenSegDynamic();
+    using SevenSegDispHw::dspBffrCntntChng;
+    /**
+     * @brief Rebuilds the changed digits words of the precompiled refresh frame
+     *
+     * The refresh frame holds a 16 bits word per digit, the segments to output (the display polarity applied) in the high byte and the port selection in the low byte, so the refreshing just streams the words, with no buffer reading, polarity or digits order mapping involved.
+     *
+     * @param chngdDgtsMsk Changed digits mask, the bit n set indicates the display's data buffer position n changed.
+     */
+    virtual void dspBffrCntntChng(const uint16_t &chngdDgtsMsk);
     /**
      * @brief Starts the timer and / or services needed to keep the display updated
      *
      * For dynamic displays a timer is needed to keep the cinematic effect of having all the digits displaying it's content at the same time.
      *
-     * @param rfrsFrq Refreshing frequency of the dynamic display in milliseconds.
+     * The displays begun with this method are registered in the refresh dispatcher, a single FreeRTOS software timer shared by all of them: each timer expiration lights the next digit of each display due, the displays ordered so the ones sharing a bus (the same GPIO port or SPI peripheral) are not serviced one after the other. The dispatcher timer period is the greatest common divisor of the registered displays periods, each display being serviced every as many dispatcher periods as it's period holds, so every display keeps it's exact period, at the cost of more frequent dispatcher expirations for periods not multiple of each other (i.e. 1 ms for displays of 2 ms and 3 ms periods). The dispatcher services the displays with the FreeRTOS scheduler suspended, so they might be ended or destroyed by any task of any priority.
+     *
+     * @param rfrsFrq Time each digit is lit, in milliseconds. If 0 the period is set to refresh each digit at 30 Hz.
      *
      * @retval true: The timer or update services were activated without issues.
-     * @retval false: The timer or update services activation failed.
+     * @retval false: The display was already begun, the maximum quantity of displays in the refresh dispatcher was reached, or the timer activation failed.
      */
     virtual bool begin(const unsigned long int &rfrshFrq = 0);
+    /**
+     * @brief Starts the display refreshing driven by a hardware timer interrupt, lighting one digit per interrupt
+     *
+     * Each period elapsed interrupt of the hardware timer sends the next digit (the digits are lit in turn, each for a full timer period), so the digits get the same lit time and the refresh is independent of the FreeRTOS tick and timer daemon task, allowing periods shorter than a tick.
+     *
+     * @param rfrshTmr Handle of the hardware timer used, with the Instance member set by the application (i.e. TIM10). The rest of the handle is initialized by this method, the timer is prescaled to 1 MHz from it's kernel clock, derived from the APB bus clock it's connected to (HAL_RCC_GetPCLK1Freq() or HAL_RCC_GetPCLK2Freq()) and the bus prescaler. The kernel clock must be a whole multiple of 1 MHz.
+     * @param dgtRfrshUs Time each digit is lit, in microseconds. If 0 the period is set to refresh the whole display at 100 Hz. For displays lighting several digits at once (see SevenSegDynHC595Chain) it's the time each group of digits is lit.
+     *
+     * @retval true: The hardware timer was configured and started.
+     * @retval false: The display was already begun, the maximum quantity of displays refreshed by hardware timers was reached, a period to program is out of the timer's range or the timer could not be started.
+     *
+     * @note Every period programmed must last from 2 microseconds up to the timer's auto-reload register range: 65536 microseconds for the 16 bits timers, all but TIM2 and TIM5. With per digit brightness enabled the shortest period is the brightness time unit, and the longest one the highest brightness bit slot.
+     * @note The HAL TIM register callbacks feature must be enabled (USE_HAL_TIM_REGISTER_CALLBACKS), and the timer update interrupt enabled in the NVIC. A hardware timer drives a single display.
+     * @note When per digit brightness is enabled (see setBrghtnssBits()) the digit period is split in binary weighted slots.
+     */
+    virtual bool begin(TIM_HandleTypeDef &rfrshTmr, const uint32_t &dgtRfrshUs = 0);
     /**
      * @brief Stops the timer and/or services needed to keep the display updated
      *
-     * The dynamic displays' refreshing timer will be stopped and deleted.
+     * The dynamic displays' refreshing timer will be stopped and deleted, or the hardware timer stopped if the display was begun with begin(TIM_HandleTypeDef&, const uint32_t&).
      *
      * @retval true: The timer or update services were deactivated without issues.
      * @retval false: The timer or update services deactivation failed.
      */
     virtual bool end();
+#if SEVENSEG_RFRSH_STATS
+    /**
+     * @brief Gets the refresh timing statistics gathered since the last resetRfrshStats()
+     *
+     * The statistics are gathered by the refresh dispatcher and the hardware timer refresh. Built only when SEVENSEG_RFRSH_STATS is set to 1.
+     *
+     * @return The refresh timing statistics.
+     *
+     * @note On the host stand-in build the time is measured with std::chrono, so the intervals reflect the pace the virtual clock is advanced at, not the virtual time.
+     */
+    rfrshStats_t getRfrshStats();
+    /**
+     * @brief Clears the refresh timing statistics
+     */
+    void resetRfrshStats();
+#endif
+    /**
+     * @brief Gets the quantity of brightness levels available for each digit
+     *
+     * @return The brightness levels quantity, 2^brightness bits, or 0 if the per digit brightness is disabled.
+     */
+    uint8_t getBrghtnssLvls();
+    /**
+     * @brief Gets a digit's brightness level
+     *
+     * @param dgtPos The display's data buffer position of the digit.
+     *
+     * @return The digit brightness level, 0 being the digit off and getBrghtnssLvls() - 1 fully lit.
+     */
+    uint8_t getDgtBrghtnss(const uint8_t &dgtPos);
+    /**
+     * @brief Sets the brightness level of all the display's digits
+     *
+     * @param newBrghtnss The new brightness level, in the range 0 <= newBrghtnss < getBrghtnssLvls().
+     *
+     * @retval true: The per digit brightness is enabled and the value is in the valid range, the brightness was set.
+     * @retval false: The brightness wasn't changed.
+     */
+    bool setBrghtnss(const uint8_t &newBrghtnss);
+    /**
+     * @brief Sets the quantity of bits of the digits brightness levels, enabling the per digit brightness control
+     *
+     * The brightness is implemented by binary code modulation (BCM) in the hardware timer refresh: each digit's period is split in one slot per brightness bit, the slot n lasting 2^n time units, and the digit is lit in the slots corresponding to the bits set in it's brightness level. Each digit takes one timer interrupt per bit instead of the one interrupt per level of a PWM implementation.
+     *
+     * All the digits brightness are set to the maximum level.
+     *
+     * @param newBrghtnssBits Quantity of bits of the brightness levels, up to 7. 0 disables the per digit brightness control, the digits are lit the whole period in a single interrupt.
+     *
+     * @retval true: The value was in the valid range and was set.
+     * @retval false: The value was out of the valid range, or the display is refreshed by a hardware timer and the resulting slots periods are out of the timer's range (see begin(TIM_HandleTypeDef&, const uint32_t&)), no change was made.
+     *
+     * @note The per digit brightness applies to the display refreshed by a hardware timer (begin(TIM_HandleTypeDef&, const uint32_t&)), the time unit being the digit period divided by (2^bits - 1), truncated to whole microseconds. The refresh driven by the FreeRTOS software timer ignores the brightness settings.
+     */
+    bool setBrghtnssBits(const uint8_t &newBrghtnssBits);
+    /**
+     * @brief Sets a digit's brightness level
+     *
+     * @param dgtPos The display's data buffer position of the digit.
+     * @param newBrghtnss The new brightness level, in the range 0 <= newBrghtnss < getBrghtnssLvls().
+     *
+     * @retval true: The per digit brightness is enabled and the values are in the valid ranges, the brightness was set.
+     * @retval false: The brightness wasn't changed.
+     */
+    bool setDgtBrghtnss(const uint8_t &dgtPos, const uint8_t &newBrghtnss);
 };
 
 //============================================================> Class declarations separator
@@ -297,9 +605,16 @@ private:
 	gpioPinId_t _sclk{};
 	gpioPinId_t _rclk{};
 	gpioPinId_t _dio{};
+	bool _sclkDioSamePort{false};
+	uint32_t _sclkSetBsrr{0};
+	uint32_t _sclkRstBsrr{0};
+	uint32_t _dioSetBsrr{0};
+	uint32_t _dioRstBsrr{0};
+	uint32_t _rclkSetBsrr{0};
+	uint32_t _rclkRstBsrr{0};
 protected:
-    virtual void refresh();
-    static void tmrCbRefreshDyn(TimerHandle_t rfrshTmrCbArg);
+    virtual const void* rfrshBusId();
+    virtual void refreshWrd(const uint16_t &rfrshWrd);
 public:
     /**
      * @brief Class constructor
@@ -315,19 +630,13 @@ public:
      * @brief Virtual destructor
      */
     ~SevenSegDynHC595();
-    /**
-     * @brief See SevenSegDynamic::begin(const unsigned long int)
-     */
-    virtual bool begin(const unsigned long int &rfrshFrq = 0);
-    /**
-     * @brief See SevenSegDynamic::end()
-     */
-    virtual bool end();
     /**
      * @brief Sends a 8 bits value to a 74HC595 shift register
      *
      * The byte value is sent through the manipulation of the DIO and SCLK lines according to the IC specifications to it's internal 8 bits buffer
      *
+     * With SEVENSEG_FAST_GPIO set the lines are driven by direct BSRR register writes, with the register words precomputed at construction: two writes per bit when DIO and SCLK share the GPIO port, three otherwise. The DIO setup and SCLK pulses are held by GPIO register read-backs, see SEVENSEG_FAST_GPIO_RDS.
+     *
      * @param content The 8 bits value to send to the IC internal 8 bits buffer
      */
     void send(uint8_t content);
@@ -343,15 +652,191 @@ public:
      * @param port A 8 bits value representing the position on the display to show the character, often as a single bit set byte.
      */
     void send(const uint8_t &segments, const uint8_t &port);
+    /**
+     * @brief Sends a sequence of bytes through a chain of 74HC595 shift registers and latches them all together.
+     *
+     * The bytes are sent in order using send(uint8_t), the first byte sent ending in the farthest register of the chain, and then the RCLK line is manipulated once to "Lock & Present" the contents of all the chained registers.
+     *
+     * @param bytesPtr Pointer to the bytes to send.
+     * @param bytesQty Quantity of bytes to send, the quantity of chained registers.
+     */
+    void sendChain(const uint8_t* bytesPtr, const uint8_t &bytesQty);
+};
+
+//============================================================> Class declarations separator
+
+/**
+ * @brief Implements Seven Segments LEDs dynamic displays built from daisy-chained 74HC595 display modules
+ *
+ * Each module of the chain is a segments shift register followed by one or two port selection shift registers (for up to 8 or up to 16 ports per module), all the modules sharing the SCLK, RCLK and DIO lines, the DIO entering the first module port selection register and each module's segments register output feeding the next module's port selection register. The display's digits are split in consecutive groups of ports per module, the first module driving the lowest display hardware positions.
+ *
+ * Each refresh slot shifts the whole chain once and latches all the modules together, so the modules light a digit each at the same time: the display is refreshed in as many slots as ports per module, and each digit is lit a (modules / digits) fraction of the time instead of (1 / digits).
+ *
+ * The slots contents are precompiled as the bytes stream to shift, rebuilt when the display's data buffer contents or the digits order change.
+ *
+ * @class SevenSegDynHC595Chain
+ */
+class SevenSegDynHC595Chain: public SevenSegDynHC595{
+private:
+	const uint8_t _dspDigitsQtyMax{16}; // Maximum display size in digits, the changed digits masks size
+	uint8_t _chnMdlsQty{1};
+	uint8_t _mdlPortBytes{1};
+	uint8_t _slotBytes{2};
+	uint8_t* _chnFrmPtr{nullptr};	// Precompiled refresh frame, the bytes stream to shift for each slot
+	uint8_t* _chnSlotBffrPtr{nullptr};
+	uint8_t* _chnBffrPosPtr{nullptr};	// Display's data buffer position shown in each display hardware position
+protected:
+	virtual void refreshSlot(const uint8_t &slot, const uint8_t &bcmBitMsk);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param ioPins Pointer to a gpioPinId_t array of three elements, with the needed MCU pins identification to drive the chain pins: SCLK, RCLK and DIO
+	 * @param dspDigits Display's length in digits quantity (dspDigitsQty attribute), 1 to 16, being a multiple of chnMdls. For a length out of that range the display is left unbuilt, and begin() fails.
+	 * @param commAnode Indicates the display leds wiring scheme, either **common anode** (true) or **common cathode** (false)
+	 * @param chnMdls Quantity of display modules in the chain.
+	 * @param mdlPortBytes Quantity of port selection shift registers in each module, 1 (up to 8 ports) or 2 (up to 16 ports). For 2 registers, the one receiving the data first selects the ports 0 to 7. When the digits per module (dspDigits / chnMdls) exceed 8 the modules are driven as having 2 registers, whatever the value set.
+	 */
+	SevenSegDynHC595Chain(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode, uint8_t chnMdls, uint8_t mdlPortBytes = 1);
+	/**
+	 * @brief Virtual destructor
+	 */
+	virtual ~SevenSegDynHC595Chain();
+	/**
+	 * @brief Starts the display refresh driven by a FreeRTOS software timer, see SevenSegDynamic::begin(const unsigned long int &)
+	 *
+	 * @retval false: The display was left unbuilt at construction, as it's length is out of range, or the refresh couldn't be started.
+	 */
+	virtual bool begin(const unsigned long int &rfrshFrq = 0);
+	/**
+	 * @brief Starts the display refresh driven by a hardware timer, see SevenSegDynamic::begin(TIM_HandleTypeDef &, const uint32_t &)
+	 *
+	 * @retval false: The display was left unbuilt at construction, as it's length is out of range, or the refresh couldn't be started.
+	 */
+	virtual bool begin(TIM_HandleTypeDef &rfrshTmr, const uint32_t &dgtRfrshUs = 0);
+	using SevenSegDynamic::dspBffrCntntChng;
+	/**
+	 * @brief Rebuilds the precompiled refresh slots bytes of the changed digits
+	 *
+	 * @param chngdDgtsMsk Changed digits mask, the bit n set indicates the display's data buffer position n changed.
+	 */
+	virtual void dspBffrCntntChng(const uint16_t &chngdDgtsMsk);
 };
 
 //============================================================> Class declarations separator
 
+/**
+ * @brief Implements specific Seven Segments LEDs dynamic display hardware based on 74HC595 shift register array, driven by a SPI peripheral with DMA
+ *
+ * The display module SCLK and DIO lines are driven by the SPI peripheral SCK and MOSI lines, and the RCLK line by a GPIO pin. Each refresh slot starts the transmission of it's digit, the two bytes (segments and port) are transmitted with HAL_SPI_Transmit_DMA(), and the data is latched by raising RCLK in the transmission complete callback, so the digit stays lit until the next slot. The CPU just starts the transfers.
+ *
+ * @note The SPI handle must be initialized by the application as master, 8 bits data size, MSB first, clock polarity low and phase on first edge, with the TX DMA stream linked, and the HAL SPI register callbacks feature enabled (USE_HAL_SPI_REGISTER_CALLBACKS). Each SPI peripheral might drive one display, and up to 4 displays might exist at the same time: the displays constructed beyond that limit can't be started.
+ *
+ * @class SevenSegDynHC595Spi
+ */
+class SevenSegDynHC595Spi: public SevenSegDynamic{
+private:
+	static const uint8_t _spiDspsQtyMax{4};
+	static SevenSegDynHC595Spi* _spiDspsLst[_spiDspsQtyMax];
+
+	const uint8_t _dspDigitsQtyMax{8}; // Maximum display size in digits, hardware dependent
+	SPI_HandleTypeDef* _spiHndlPtr{nullptr};
+	gpioPinId_t _rclk{};
+	uint8_t _spiTxBffr[2]{};
+	volatile uint8_t _spiDgtsPndng{0};
+	bool _spiRgstrd{false};
+
+	void _spiTxWrd(const uint16_t &rfrshWrd);
+	static void spiCbTxCplt(SPI_HandleTypeDef* hspi);
+protected:
+	virtual const void* rfrshBusId();
+	virtual void refreshWrd(const uint16_t &rfrshWrd);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param spiHndlPtr Pointer to the initialized handle of the SPI peripheral driving the SCLK and DIO lines.
+	 * @param rclk The MCU pin identification of the RCLK line.
+	 * @param dspDigits Display's length in digits quantity (dspDigitsQty attribute).
+	 * @param commAnode Indicates the display leds wiring scheme, either **common anode** (true) or **common cathode** (false)
+	 */
+	SevenSegDynHC595Spi(SPI_HandleTypeDef* spiHndlPtr, const gpioPinId_t &rclk, uint8_t dspDigits, bool commAnode);
+	/**
+	 * @brief Virtual destructor
+	 */
+	virtual ~SevenSegDynHC595Spi();
+	/**
+	 * @brief Starts the display refresh driven by a FreeRTOS software timer, see SevenSegDynamic::begin(const unsigned long int &)
+	 *
+	 * @retval false: The display couldn't be registered for the SPI transmission complete callbacks at construction, as the maximum quantity of SevenSegDynHC595Spi displays was reached, or the refresh couldn't be started.
+	 */
+	virtual bool begin(const unsigned long int &rfrshFrq = 0);
+	/**
+	 * @brief Starts the display refresh driven by a hardware timer, see SevenSegDynamic::begin(TIM_HandleTypeDef &, const uint32_t &)
+	 *
+	 * @retval false: The display couldn't be registered for the SPI transmission complete callbacks at construction, as the maximum quantity of SevenSegDynHC595Spi displays was reached, or the refresh couldn't be started.
+	 */
+	virtual bool begin(TIM_HandleTypeDef &rfrshTmr, const uint32_t &dgtRfrshUs = 0);
+	/**
+	 * @brief Gets the transmission state of the refresh slot in progress
+	 *
+	 * @retval true: A digit is being transmitted, the slots refreshed meanwhile are skipped.
+	 * @retval false: No digit is being transmitted.
+	 */
+	bool getSpiBusy();
+};
+
+//============================================================> Class declarations separator
+
+/**
+ * @brief Implements a generic Seven Segments LEDs static hardware interface, with driver chips holding the displayed contents
+ *
+ * The display's data buffer changes are posted as frames, a snapshot of the display's data buffer contents, to be transmitted asynchronously by the subclasses, so the invoking task never waits for the hardware transmission. A single frame is kept pending: when a newer frame is posted before the pending one starts being transmitted, the pending frame is dropped, and it's changed digits are coalesced into the newer frame.
+ *
+ * @class SevenSegStatic
+ */
 class SevenSegStatic: public SevenSegDispHw{
+protected:
+	uint8_t* _txFrmBffr{nullptr};
+	uint16_t _txFrmChngdMsk{0};
+	volatile bool _txFrmPndng{false};
+	uint32_t _txFrmsDrpd{0};
+	uint32_t _txFrmsSent{0};
 
+	void _txFrmDscrd();
+	virtual void _txFrmPstd(){};
+	void _txFrmSent();
+	bool _txFrmTake(uint16_t &chngdDgtsMsk);
 public:
 	SevenSegStatic(gpioPinId_t* ioPins, uint8_t dspDigits, bool commAnode);
 	virtual ~SevenSegStatic();
+	using SevenSegDispHw::dspBffrCntntChng;
+	/**
+	 * @brief Posts a frame with the display's data buffer contents for asynchronous transmission
+	 *
+	 * The frame snapshot is taken and the method returns without waiting for the transmission, see the class description for the frames coalescing.
+	 *
+	 * @param chngdDgtsMsk Changed digits mask, the bit n set indicates the display's data buffer position n changed.
+	 */
+	virtual void dspBffrCntntChng(const uint16_t &chngdDgtsMsk);
+	/**
+	 * @brief Gets the number of frames posted and not yet transmitted
+	 *
+	 * @return 1 if a frame is pending, 0 otherwise, as pending frames are coalesced into a single one.
+	 */
+	uint8_t getTxFrmsPndng();
+	/**
+	 * @brief Gets the number of frames dropped by coalescing since the last resetTxFrmsCntrs()
+	 */
+	uint32_t getTxFrmsDrpd();
+	/**
+	 * @brief Gets the number of frames completely transmitted since the last resetTxFrmsCntrs()
+	 */
+	uint32_t getTxFrmsSent();
+	/**
+	 * @brief Resets the dropped and sent frames counters
+	 */
+	void resetTxFrmsCntrs();
 };
 
 //============================================================> Class declarations separator
@@ -373,11 +858,26 @@ public:
  *
  * @note As the communications protocol does't comply with the I2C protocol, the communications must be implemented in software. For that reason, for resources saving sake, the CLK speed will be reduced from the data sheet **Maximum clock frequency** stated as 500KHz to a less demanding 100KHz time slices, managed by a timer interrupt set at 100KHz, enabling the timer interrupt service only while transmitting data, and disabling it while idle. The transmission protocol will implement the data sheet requirements, part of it being the use of a 0.5 long CLK multiples for signaling, so **TWO** 100 KHz periods will be set as the CLK width standard.
  *
+ * The transmission is a state machine advanced one step by each timer interrupt, so the bus runs in the background while the invoking task goes on. The timer is shared by all the TM163X displays: the displays with a posted frame wait their turn in a FIFO list, and the frame posted while waiting or transmitting is sent in the display's next turn. The DIO line is set as open drain, released to read the chip's ACK.
+ *
+ * Only the changed digits of each frame are transmitted, choosing the cheapest of the two addressing modes provided by the chips, measured in CLK periods on the bus:
+ * - Address auto-increment mode: each run of consecutive display addresses is sent as an address command followed by the run's data. Runs separated by a single unchanged address are merged, as resending that one byte is cheaper than starting a new frame.
+ * - Fixed address mode: each changed address is sent as an address command followed by it's data byte.
+ *
+ * The display control command (Command3) is appended only when the display on/off state or the brightness level changed since the last transmission.
+ *
  * @class SevenSegTM163X
  */
+class SevenSegTM163XBus;
+
 class SevenSegTM163X: public SevenSegStatic{
+	friend class SevenSegTM163XBus;
    static TIM_HandleTypeDef _txTM163xTmr;
 	static uint8_t _usTmrUsrs;
+	static SevenSegTM163X* _txActvInstPtr;
+	static SevenSegTM163X* _txWtngHdPtr;
+	static SevenSegTM163X* _txWtngTlPtr;
+	static SevenSegTM163XBus* _txActvBusPtr;
 
 protected:
    gpioPinId_t _clk{};
@@ -390,23 +890,77 @@ protected:
    const uint8_t _brghtnssLvlMin{};
    uint8_t* _mssgBffr{nullptr};
    uint8_t _mssgBffrLngth{0};
+   bool _dspCtrlChng{true};
+
+   enum txStts_t: uint8_t {txIdle, txStart, txWrByte, txAsk, txStop};
+   bool _txBgn{false};
+   bool _txRsndAll{false};
+   bool _txWtng{false};
+   SevenSegTM163X* _txWtngNxtPtr{nullptr};
+   volatile txStts_t _txStts{txIdle};
+   uint8_t _txStep{0};
+   uint8_t _txFrmPos{0};
+   uint8_t _txBytePos{0};
+   uint8_t _txBitPos{0};
+   uint8_t _txAckWtTcks{0};
+   bool _txAbrt{false};
+   TaskHandle_t _txCmpltTskHndl{NULL};
+   SevenSegTM163XBus* _busPtr{nullptr};
 
    bool _turnOff();
    bool _turnOn();
 
-   void delay10UsTck(const uint32_t &actDelay);
-   void send(const uint8_t* data, const uint8_t dataQty);
+   uint8_t _bldMssg(const uint16_t &chngdDgtsMsk);
+   bool _txActv();
+   virtual void _txFrmPstd();
+   bool _txLoad();
+   void _txQueue();
+   void _txUnqueue();
+   void _txTck();
+   void _txDone(BaseType_t &tskWoken);
+   void _txEnd();
    void _txStart();
    void _txAsk();
    void _txStop();
-   void _txWrByte(const uint8_t data);
+   void _txWrByte();
+   static void _txStrtNxt();
+   static void tmrCbTx(TIM_HandleTypeDef *htim);
 
 public:
 	SevenSegTM163X(gpioPinId_t* ioPins, uint8_t dspDigits);
 	~SevenSegTM163X();
+	/**
+	 * @brief Sets up the shared transmission timer and turns the display on
+	 *
+	 * The timer is configured when the first TM163X display is started, it's interrupts are enabled only while a transmission is in progress. The whole display's data buffer contents and the display control command are queued for transmission.
+	 *
+	 * @retval true: The display was started, or it was already started.
+	 */
 	bool begin(TIM_HandleTypeDef &newTxTM163xTmr);
-	virtual void dspBffrCntntChng();
+	/**
+	 * @brief Stops the display transmissions
+	 *
+	 * The pending changes are discarded and a transmission in progress is ended with a Stop signal at the next timer interrupt.
+	 *
+	 * @retval true: The display was started and is now stopped.
+	 * @retval false: The display was not started.
+	 */
 	bool end();
+	/**
+	 * @brief Gets the transmission state of the display
+	 *
+	 * @retval true: Changes of the display are being transmitted or waiting to be transmitted.
+	 * @retval false: The chip's display RAM holds the last notified display's data buffer contents.
+	 */
+	bool getTxBusy();
+	/**
+	 * @brief Sets the task to be notified when each transmission to the display completes
+	 *
+	 * The task is notified with vTaskNotifyGiveFromISR() from the timer interrupt, so it might wait for the completion with ulTaskNotifyTake().
+	 *
+	 * @param newTxCmpltTskHndl Handle of the task to notify, NULL to stop notifying.
+	 */
+	void setTxCmpltTskHndl(TaskHandle_t newTxCmpltTskHndl);
 	bool getBrghtnss();
 	bool getBrghtnssMaxLvl();
 	bool getBrghtnssMinLvl();
@@ -416,6 +970,67 @@ public:
 
 //============================================================> Class declarations separator
 
+/**
+ * @brief Implements a bus group of TM163X displays transmitting in parallel
+ *
+ * The displays of the group share the CLK pin, and have their DIO pins on a single GPIO port. Each CLK edge is produced with a single GPIO register write, and the DIO lines of all the displays of the group with another one, so the frames of all the displays of the group are transmitted in the time of the longest of them, instead of one display after the other.
+ *
+ * The group takes the turn of any of it's displays in the TM163X shared timer FIFO list, and transmits the posted frames of all it's displays in that turn.
+ *
+ * @note The displays must be constructed with the group's CLK pin and a DIO pin in the group's DIO port, and started with their own begin() method.
+ *
+ * @class SevenSegTM163XBus
+ */
+class SevenSegTM163XBus{
+	friend class SevenSegTM163X;
+	static const uint8_t _dspsQtyMax{8};
+
+	gpioPinId_t _clk{};
+	GPIO_TypeDef* _dioPort{nullptr};
+	SevenSegTM163X* _dspsPtrs[_dspsQtyMax]{};
+	uint8_t _dspsQty{0};
+	uint8_t _txStep{0};
+
+	bool _txLoad(SevenSegTM163X* frstDspPtr);
+	void _txTck();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param clk The MCU pin identification of the CLK line shared by the group's displays.
+	 * @param dioPort The GPIO port of the group's displays DIO pins.
+	 */
+	SevenSegTM163XBus(const gpioPinId_t &clk, GPIO_TypeDef* dioPort);
+	/**
+	 * @brief Class destructor, the attached displays are detached
+	 */
+	~SevenSegTM163XBus();
+	/**
+	 * @brief Attaches a display to the group
+	 *
+	 * @param dspPtr Pointer to the display to attach.
+	 *
+	 * @retval true: The display was attached.
+	 * @retval false: The group is full, the display's pins don't match the group's CLK pin and DIO port, the display is attached to a group or it's transmitting.
+	 */
+	bool attach(SevenSegTM163X* dspPtr);
+	/**
+	 * @brief Detaches a display from the group, the display transmits on it's own afterwards
+	 *
+	 * @param dspPtr Pointer to the display to detach.
+	 *
+	 * @retval true: The display was detached.
+	 * @retval false: The display was not attached to the group.
+	 */
+	bool detach(SevenSegTM163X* dspPtr);
+	/**
+	 * @brief Gets the number of displays attached to the group
+	 */
+	uint8_t getDspsQty();
+};
+
+//============================================================> Class declarations separator
+
 class SevenSegTM1637: public SevenSegTM163X{
 protected:
 	const uint8_t _dspDigitsQtyMax{6}; // Maximum display size in digits, hardware dependent
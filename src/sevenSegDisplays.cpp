@@ -20,23 +20,104 @@
 
 #include "sevenSegDisplays.h"
 
+//--------------------------------------------------------------- Seven segments font
+const uint8_t NO_GLYPH{0x00};	//Glyphs table value for the non displayable characters, as the "all segments lit" pattern is not part of the font
+const uint8_t SPACE_GLYPH{0xFF};
+const uint8_t DOT_GLYPH{0x7F};
+
+/**
+ * @brief ASCII code indexed seven segments glyphs table
+ *
+ * The font encoding is the Common Anode display encoding (a segment is lit when it's bit is reset), and it's the encoding used for all the display buffers contents. The underlying hardware applies the display polarity when outputting the buffer contents. Non displayable characters are set to NO_GLYPH. Being a constant expression object the table is located in flash, shared by all the displays, and the character translation is reduced to a single indexed read.
+ */
+struct SevenSegFont{
+	uint8_t glyphs[256];
+
+	constexpr SevenSegFont(): glyphs{}{
+		for(int i{0}; i < 256; i++)
+			glyphs[i] = NO_GLYPH;
+		glyphs['0'] = 0xC0;
+		glyphs['1'] = 0xF9;
+		glyphs['2'] = 0xA4;
+		glyphs['3'] = 0xB0;
+		glyphs['4'] = 0x99;
+		glyphs['5'] = 0x92;
+		glyphs['6'] = 0x82;
+		glyphs['7'] = 0xF8;
+		glyphs['8'] = 0x80;
+		glyphs['9'] = 0x90;
+		glyphs['A'] = 0x88;
+		glyphs['a'] = 0xA0;
+		glyphs['b'] = 0x83;
+		glyphs['C'] = 0xC6;
+		glyphs['c'] = 0xA7;
+		glyphs['d'] = 0xA1;
+		glyphs['E'] = 0x86;
+		glyphs['e'] = 0x84;
+		glyphs['F'] = 0x8E;
+		glyphs['G'] = 0xC2;
+		glyphs['H'] = 0x89;
+		glyphs['h'] = 0x8B;
+		glyphs['I'] = 0xF9;
+		glyphs['i'] = 0xFB;
+		glyphs['J'] = 0xF1;
+		glyphs['L'] = 0xC7;
+		glyphs['l'] = 0xCF;
+		glyphs['n'] = 0xAB;
+		glyphs['O'] = 0xC0;
+		glyphs['o'] = 0xA3;
+		glyphs['P'] = 0x8C;
+		glyphs['q'] = 0x98;
+		glyphs['r'] = 0xAF;
+		glyphs['S'] = 0x92;
+		glyphs['t'] = 0x87;
+		glyphs['U'] = 0xC1;
+		glyphs['u'] = 0xE3;
+		glyphs['Y'] = 0x91;
+		glyphs['-'] = 0xBF;	// Minus
+		glyphs['_'] = 0xF7;	// Underscore
+		glyphs['='] = 0xB7;	// Low =
+		glyphs['~'] = 0xB6;	// Equivalent symbol
+		glyphs['*'] = 0x9C;	// Degree
+		glyphs[' '] = 0xFF;	// Space
+		glyphs['.'] = 0x7F;	// Dot
+	}
+};
+
+constexpr SevenSegFont font{};
+
+//--------------------------------------------------------------- Static members
+
 uint8_t SevenSegDisplays::_displaysCount = 0;
 uint16_t SevenSegDisplays::_dspSerialNum = 0;
 uint8_t SevenSegDisplays::_dspPtrArrLngth = MAX_DISPLAYS_QTY;
-SevenSegDisplays** SevenSegDisplays::_instancesLstPtr = nullptr;
+SevenSegDisplays* SevenSegDisplays::_instancesLst[MAX_DISPLAYS_QTY]{};	//Statically allocated, no heap is used to register the displays
+SevenSegDisplays** SevenSegDisplays::_instancesLstPtr = SevenSegDisplays::_instancesLst;
+TimerHandle_t SevenSegDisplays::_animTmrHndl = NULL;
+#if configSUPPORT_STATIC_ALLOCATION
+StaticTimer_t SevenSegDisplays::_animTmrBffr{};
+#endif
 
 SevenSegDisplays::SevenSegDisplays(SevenSegDispHw* dspUndrlHwPtr)
-:_dspUndrlHwPtr{dspUndrlHwPtr}
+:SevenSegDisplays(dspUndrlHwPtr, nullptr, nullptr, nullptr, 0)
 {
-	if(_instancesLstPtr == nullptr){
-      _instancesLstPtr = new SevenSegDisplays*[_dspPtrArrLngth](); //Creates the array in memory and then initializes al values to nullptr
-      for(int i{0}; i < _dspPtrArrLngth; i++)
-         *(_instancesLstPtr + i) = nullptr;
-   }
-   if(_displaysCount < _dspPtrArrLngth){
+}
+
+SevenSegDisplays::SevenSegDisplays(SevenSegDispHw* dspUndrlHwPtr, uint8_t* dspBuffPtr, uint8_t* dspAuxBuffPtr, bool* blinkMaskPtr, uint8_t bffrsLngth)
+:_bffrsOwnd{dspBuffPtr == nullptr}, _dspUndrlHwPtr{dspUndrlHwPtr}
+{
+   if((_displaysCount < _dspPtrArrLngth) && (_dspUndrlHwPtr->getDspDigits() <= MAX_DIGITS_PER_DISPLAY) && (_bffrsOwnd || (_dspUndrlHwPtr->getDspDigits() <= bffrsLngth))){	//The rendering frames and the changed digits masks are MAX_DIGITS_PER_DISPLAY digits long
       _dspDigitsQty = _dspUndrlHwPtr->getDspDigits(); //Now that we know the display size in digits, we can build the needed arrays for data
-      _dspBuffPtr  = new uint8_t[_dspDigitsQty];
-      _blinkMaskPtr = new bool[_dspDigitsQty];
+      if(_bffrsOwnd){	//The auxiliary buffer is kept for the object's lifetime too, so blinking and waiting never allocate
+         _dspBuffPtr  = new uint8_t[_dspDigitsQty];
+         _dspAuxBuffPtr = new uint8_t[_dspDigitsQty];
+         _blinkMaskPtr = new bool[_dspDigitsQty];
+      }
+      else{
+         _dspBuffPtr = dspBuffPtr;
+         _dspAuxBuffPtr = dspAuxBuffPtr;
+         _blinkMaskPtr = blinkMaskPtr;
+      }
       _dspUndrlHwPtr->setDspBuffPtr(_dspBuffPtr); //Indicate the hardware where the data to display is located
       _dspInstNbr = _dspSerialNum++; //This value is always incremented, as it's not related to the active objects but to amount of different displays created
       ++_displaysCount;  //This keeps the count of instantiated SevenSegDisplays objects
@@ -48,22 +129,27 @@ SevenSegDisplays::SevenSegDisplays(SevenSegDispHw* dspUndrlHwPtr)
          }
       }
       setAttrbts();
+#if SEVENSEG_STATS
+      statsCycCntInit();
+#endif
       clear();
    }
 }
 
 SevenSegDisplays::~SevenSegDisplays(){
     if(_blinking)
-        noBlink();  //Stops the blinking, frees the _dspAuxBuffPtr pointed memory, Stops the timer attached to the process
+        noBlink();  //Stops the blinking, the animation timer will find no pending effect for the display
     if(_waiting)
-        noWait();   //Stops the waiting, frees the _dspAuxBuffPtr pointed memory, Stops the timer attached to the process
-    if(_dspAuxBuffPtr){
+        noWait();   //Stops the waiting, the animation timer will find no pending effect for the display
+    if(!_dspBuffPtr)	//The display was not built
+        return;
+    if(_bffrsOwnd){
         delete [] _dspAuxBuffPtr;   //Free the resources of the auxiliary display digits buffer (to keep a copy of the dspBuffer contents for blinking, waiting, etc.)
-        _dspAuxBuffPtr = nullptr;
+        delete [] _blinkMaskPtr;    //Free the resources of the blink mask buffer
+        delete [] _dspBuffPtr;  //Free the resources of the display digits buffer
     }
-    delete [] _blinkMaskPtr;    //Free the resources of the blink mask buffer
+    _dspAuxBuffPtr = nullptr;
     _blinkMaskPtr = nullptr;
-    delete [] _dspBuffPtr;  //Free the resources of the display digits buffer
     _dspBuffPtr = nullptr;
     for(uint8_t i{0}; i<_dspPtrArrLngth; i++){
         if(*(_instancesLstPtr+  i) == _dspInstance){
@@ -81,42 +167,21 @@ bool SevenSegDisplays::begin(){
 
 bool SevenSegDisplays::blink(){
    bool result {false};
-   BaseType_t tmrModResult {pdFAIL};
 
 	if (!_blinking){
-		//Create a valid unique Name for identifying the timer created
-		std::string blnkTmrNameStr{ "Disp" };
-		std::string dspSerialNumStr{ "00" + std::to_string(_dspSerialNum) };
-		dspSerialNumStr = dspSerialNumStr.substr(dspSerialNumStr.length() - 2, 2);
-		blnkTmrNameStr = blnkTmrNameStr + dspSerialNumStr + "blnk_tmr";	// The HR name for the thimer with the structure "DispXXblnk_tmr" created
-
-		if(!_blinkTmrHndl){
-			_blinkTmrHndl = xTimerCreate(	//Creation of the blinker timer
-				blnkTmrNameStr.c_str(),
-				pdMS_TO_TICKS(_blinkRatesGCD),
-				pdTRUE,  //Autoreload
-				_dspInstance,   //TimerID, data to be passed to the callback function
-				tmrCbBlink  //Callback function
-			);
-		}
-		if(_blinkTmrHndl && (!xTimerIsTimerActive(_blinkTmrHndl))){
-			// The timer was created, but it wasn't active. Prepare to start the timer
+		if(!_animTmrHndl)
+			createAnimTmr();
+		if(_animTmrHndl){
          if(_waiting)   //If the display is waiting the blinking option doesn't achieve the desired effect, waiting is here disabled
          	noWait();
-         _dspAuxBuffPtr = new uint8_t[_dspDigitsQty];
-			_blinkShowOn = false;
-			_blinkTimer = 0;  //Start the blinking pace timer...
-
-			tmrModResult = xTimerStart(
-					_blinkTmrHndl,
-					portMAX_DELAY
-					);
-			if (tmrModResult == pdPASS){
-				_blinking = true;
+			_blinkShowOn = true;	//The blinking starts with the turn-On stage, as the display is showing it's contents
+			_blinkNxtTck = xTaskGetTickCount() + pdMS_TO_TICKS(_blinkOnRate);
+			_blinking = true;
+			if (updAnimTmr(portMAX_DELAY) == pdPASS){
 				result = true;
 			}
 			else{
-				delete [] _dspAuxBuffPtr;	//xTimerStart failed, avoid memory leaking by returning unused buffer space
+				_blinking = false;
 			}
 		}
 	}
@@ -139,53 +204,76 @@ bool SevenSegDisplays::blink(const unsigned long &onRate, const unsigned long &o
    return result;
 }
 
-unsigned long SevenSegDisplays::blinkTmrGCD(unsigned long blnkOnTm, unsigned long blnkOffTm){
-   /*returning values:
-      0: One of the input values was 0
-      1: No GDC greater than 1
-      Other: This value would make the blink timer save resources by checking the blink time as less frequent as possible*/
-   unsigned long result{ 0 };
+void SevenSegDisplays::createAnimTmr(){
+	//The animation timer is shared by all the displays, reprogrammed to the earliest animation effect update after each expiration. Never deleted, it's statically allocated when supported
+	//It's auto-reload so a reprogramming command lost (timer command queue full) leaves it expiring again with the previous period, instead of stopping every animation
+#if configSUPPORT_STATIC_ALLOCATION
+	_animTmrHndl = xTimerCreateStatic(
+		"SvnSegAnim_tmr",
+		1,	//Temporary period, set when the timer is started by updAnimTmr()
+		pdTRUE,  //Auto-reload, see above
+		nullptr,   //TimerID, the callback walks the displays list
+		tmrCbAnim,  //Callback function
+		&_animTmrBffr
+	);
+#else
+	_animTmrHndl = xTimerCreate(
+		"SvnSegAnim_tmr",
+		1,	//Temporary period, set when the timer is started by updAnimTmr()
+		pdTRUE,  //Auto-reload, see above
+		nullptr,   //TimerID, the callback walks the displays list
+		tmrCbAnim  //Callback function
+	);
+#endif
+
+	return;
+}
 
-   if ((blnkOnTm != 0) && (blnkOffTm != 0)) {
-      if (blnkOnTm == blnkOffTm) {
-         result = blnkOnTm;
-      }
-      else if ((blnkOnTm % blnkOffTm == 0) || (blnkOffTm % blnkOnTm == 0)) {
-         result = (blnkOffTm < blnkOnTm)? blnkOffTm : blnkOnTm;
-      }
+void SevenSegDisplays::crtclEnter(){
+   //Critical section over the display buffers, timed when the statistics are built. Nested sections are accounted as the outer one
+   taskENTER_CRITICAL();
+#if SEVENSEG_STATS
+   if(_crtclNstng++ == 0)
+      _crtclStrtCyc = statsCycCnt();
+#endif
 
-      if (result == 0) {
-         for (unsigned long int i{ (blnkOnTm < blnkOffTm) ? blnkOnTm : blnkOffTm }; i > 0; i--) {
-				if ((blnkOnTm % i == 0) && (blnkOffTm % i == 0)) {
-					result = i;
-					break;
-				}
-         }
-      }
+   return;
+}
+
+void SevenSegDisplays::crtclExit(){
+#if SEVENSEG_STATS
+   if(--_crtclNstng == 0){
+      ++_stats.crtclSctnsCnt;
+      _stats.crtclSctnsCyc += static_cast<uint32_t>(statsCycCnt() - _crtclStrtCyc);
    }
+#endif
+   taskEXIT_CRITICAL();
 
-   return result;
+   return;
 }
 
 void SevenSegDisplays::clear(){
    //Cleans the contents of the internal display buffer (All leds off for all digits)
-      taskENTER_CRITICAL();
+   uint16_t chngdDgtsMsk{0};
+
+      crtclEnter();
       if(_blinking || _waiting){
          //If the display is blinking the backup buffer will be restored, so the display clearing() would be reverted
          //So BOTH buffers must be cleared, starting by the _dspAuxBuff, and blocking the access to it while clearing takes place
       	for (int i{0}; i < _dspDigitsQty; i++){
-            if(*(_dspAuxBuffPtr + i) != _space){
-               *(_dspAuxBuffPtr + i) = _space;
+            if(*(_dspAuxBuffPtr + i) != SPACE_GLYPH){
+               *(_dspAuxBuffPtr + i) = SPACE_GLYPH;
             }
          }
       }
       for (int i{0}; i < _dspDigitsQty; i++){
-         if(*(_dspBuffPtr + i) != _space){
-            *(_dspBuffPtr + i) = _space;
-         	_dspUndrlHwPtr -> dspBffrCntntChng();
+         if(*(_dspBuffPtr + i) != SPACE_GLYPH){
+            *(_dspBuffPtr + i) = SPACE_GLYPH;
+            chngdDgtsMsk |= (uint16_t(1) << i);
          }
       }
-   	taskEXIT_CRITICAL();
+   	crtclExit();
+   	notifyDspBuffChng(chngdDgtsMsk);
 
    return;
 }
@@ -329,11 +417,23 @@ unsigned long  SevenSegDisplays::getMinBlinkRate(){
    return _minBlinkRate;
 }
 
+#if SEVENSEG_STATS
+dspStats_t SevenSegDisplays::getStats(){
+   dspStats_t result{};
+
+   taskENTER_CRITICAL();
+   result = _stats;
+   taskEXIT_CRITICAL();
+
+   return result;
+}
+#endif
+
 bool SevenSegDisplays::isBlank(){
    uint8_t result{true};
 
    for (int i{0}; i < _dspDigitsQty; i++){
-      if(*(_dspBuffPtr + i) != _space){
+      if(*(_dspBuffPtr + i) != SPACE_GLYPH){
          result = false;
          break;
       }
@@ -352,77 +452,83 @@ bool SevenSegDisplays::isWaiting(){
    return _waiting;
 }
 
-bool SevenSegDisplays::noBlink(){
-   bool result {false};
-    BaseType_t tmrModResult {pdFAIL};
+void SevenSegDisplays::loadDspBuff(const uint8_t* newContents){
+   //A nullptr newContents indicates the contents to load were not displayable, the display is cleared instead
+   bool loadOnBlink{_blinking};
+   uint16_t chngdDgtsMsk{0};
 
-    //Stops the blinking timer, frees the _dspAuxPtr pointed memory, cleans flags
-    if(_blinking){
-		if(_blinkTmrHndl){   //Verify the timer handle is still valid
-			tmrModResult = xTimerStop(_blinkTmrHndl, portMAX_DELAY);
-			if(tmrModResult == pdPASS){
-				tmrModResult = xTimerDelete(_blinkTmrHndl, portMAX_DELAY);
-				if(tmrModResult == pdPASS){
-					_blinkTmrHndl = NULL;
-					restoreDspBuff();
-			      delete [] _dspAuxBuffPtr;
-			      _dspAuxBuffPtr = nullptr;
-					_blinkTimer = 0;
-					_blinkShowOn = true;
-					_blinking = false;
-					result = true;
-				}
-			}
+   if(!newContents){
+      clear();
+      return;
+   }
+   if(_waiting)
+      noWait();
+   if(loadOnBlink)
+      noBlink();
+   crtclEnter();
+   for (uint8_t i{0}; i < _dspDigitsQty; ++i){
+      if(*(_dspBuffPtr + i) != *(newContents + i)){
+         *(_dspBuffPtr + i) = *(newContents + i);
+         chngdDgtsMsk |= (uint16_t(1) << i);
       }
-    }
-    else{
-   	 result = true;
+   }
+   crtclExit();
+   if(loadOnBlink)
+      blink();
+	notifyDspBuffChng(chngdDgtsMsk);
+
+   return;
+}
+
+bool SevenSegDisplays::noBlink(){
+    //Stops the blinking, cleans flags. The animation timer will find no pending effect for the display when expired
+    if(_blinking){
+		_blinking = false;
+		if(!_blinkShowOn)	//The dspAuxBuff holds the contents to restore only during the turn-Off stage
+			restoreDspBuff();
+		_blinkShowOn = true;
     }
 
-   return result;
+   return true;
 }
 
-bool SevenSegDisplays::noWait(){
-   bool result {false};
-    BaseType_t tmrModResult {pdFAIL};
+void SevenSegDisplays::notifyDspBuffChng(const uint16_t &chngdDgtsMsk){
+   //A single notification is sent to the underlying hardware for each logical display update, if any digit changed
+   if(chngdDgtsMsk){
+#if SEVENSEG_STATS
+      ++_stats.hwNtfctnsCnt;
+#endif
+      _dspUndrlHwPtr -> dspBffrCntntChng(chngdDgtsMsk);
+   }
 
-    //Stops the waiting timer, frees the _dspAuxPtr pointed memory, Stops the timer attached to the process
+   return;
+}
+
+bool SevenSegDisplays::noWait(){
+    //Stops the waiting, cleans flags. The animation timer will find no pending effect for the display when expired
    if (_waiting){
-      if(_waitTmrHndl){   //if the timer still exists and is running, stop and delete
-         tmrModResult = xTimerStop(_waitTmrHndl, portMAX_DELAY);
-         if(tmrModResult == pdPASS){
-            tmrModResult = xTimerDelete(_waitTmrHndl, portMAX_DELAY);
-				if(tmrModResult == pdPASS){
-					_waitTmrHndl = NULL;
-					restoreDspBuff();
-					delete [] _dspAuxBuffPtr;
-					_dspAuxBuffPtr = nullptr;
-					_waitTimer = 0;
-					_waiting = false;
-					result = true;
-				}
-         }
-      }
-   }
-   else{
-   	result = true;
+		_waiting = false;
+		restoreDspBuff();
+		_waitTimer = 0;
    }
 
-   return result;
+   return true;
 }
 
 bool SevenSegDisplays::print(std::string text){
    bool displayable{true};
-   bool printOnBlink{_blinking};
-   int position{-1};
+   uint8_t glyph{NO_GLYPH};
 
    std::string tempText{""};
-   uint8_t temp7SegData[_dspDigitsQty];
-   uint8_t tempDpData[_dspDigitsQty];
+   uint8_t temp7SegData[MAX_DIGITS_PER_DISPLAY];
+   uint8_t tempDpData[MAX_DIGITS_PER_DISPLAY];
 
+#if SEVENSEG_TRACE
+   _dspUndrlHwPtr->trace(trcPrintBgn, trcPrintTxt);
+#endif
    for (int i{0}; i < _dspDigitsQty; i++){
-      temp7SegData[i] = _space;
-      tempDpData[i] = _space;
+      temp7SegData[i] = SPACE_GLYPH;
+      tempDpData[i] = SPACE_GLYPH;
    }
    // Finds out if there are '.' in the string to display, creates a mask to add them to the display
    // and takes them out of the string to process the chars/digits
@@ -433,16 +539,16 @@ bool SevenSegDisplays::print(std::string text){
          if (i == 0 || text.at(i-1) == '.')
             tempText += " ";
          if(tempText.length() <= _dspDigitsQty)
-            tempDpData[_dspDigitsQty - tempText.length()] = _dot;
+            tempDpData[_dspDigitsQty - tempText.length()] = DOT_GLYPH;
       }
    }
    text = tempText;
    if (text.length() <= _dspDigitsQty){
       for (unsigned int i {0}; i < text.length(); ++i){
-         position = _charSet.find(text.at(i));
-         if (position > -1) {
+         glyph = font.glyphs[static_cast<uint8_t>(text.at(i))];
+         if (glyph != NO_GLYPH) {
             // Character found for translation
-            temp7SegData[(_dspDigitsQty - 1) - i] = _charLeds[position];
+            temp7SegData[(_dspDigitsQty - 1) - i] = glyph;
          }
          else {
             displayable = false;
@@ -454,99 +560,140 @@ bool SevenSegDisplays::print(std::string text){
       displayable = false;
    }
    if (displayable) {
-      if(_waiting)
-         noWait();
-      if(printOnBlink)
-         noBlink();
-      taskENTER_CRITICAL();
       for (uint8_t i{0}; i < _dspDigitsQty; ++i)
-         *(_dspBuffPtr + i) = temp7SegData[i] & tempDpData[i];
-      taskEXIT_CRITICAL();
-      if(printOnBlink)
-         blink();
-   	_dspUndrlHwPtr -> dspBffrCntntChng();
-   }
-   else{
-   	clear();
+         temp7SegData[i] &= tempDpData[i];
    }
+   loadDspBuff(displayable? temp7SegData : nullptr);
+#if SEVENSEG_STATS
+   ++_stats.printsCnt;
+   if(!displayable)
+      ++_stats.printsRjctd;
+#endif
+#if SEVENSEG_TRACE
+   _dspUndrlHwPtr->trace(trcPrintEnd, displayable? 1 : 0);
+#endif
 
    return displayable;
 }
 
 bool SevenSegDisplays::print(const int32_t &value, bool rgtAlgn, bool zeroPad){
-   bool displayable{true};
-   std::string readOut{""};
+   bool displayable{false};
+   uint8_t frame[MAX_DIGITS_PER_DISPLAY];
+
+#if SEVENSEG_TRACE
+   _dspUndrlHwPtr->trace(trcPrintBgn, trcPrintInt);
+#endif
+   if ((value >= _dspValMin) && (value <= _dspValMax))
+      displayable = renderFixed(frame, value, 0, rgtAlgn, zeroPad);
+   loadDspBuff(displayable? frame : nullptr);
+#if SEVENSEG_STATS
+   ++_stats.printsCnt;
+   if(!displayable)
+      ++_stats.printsRjctd;
+#endif
+#if SEVENSEG_TRACE
+   _dspUndrlHwPtr->trace(trcPrintEnd, displayable? 1 : 0);
+#endif
 
-   if ((value < _dspValMin) || (value > _dspValMax)) {
-      clear();
-      displayable = false;
-   }
-   else {
-      readOut = std::to_string(abs(value));
-      if (rgtAlgn) {
-         if (zeroPad)
-            readOut = _zeroPadding + readOut;
-         else
-            readOut = _spacePadding + readOut;
-
-         if (value >= 0)
-            readOut = readOut.substr(readOut.length() - _dspDigitsQty);
-         else
-            readOut = readOut.substr(readOut.length() - (_dspDigitsQty - 1));
-      }
-      if (value < 0)
-         readOut = "-" + readOut;
-      displayable = print(readOut);
+   return displayable;
+}
+
+bool SevenSegDisplays::print(const double &value, const unsigned int &decPlaces, bool rgtAlgn, bool zeroPad){
+   bool displayable{false};
+   double scaledVal{value};
+   uint8_t frame[MAX_DIGITS_PER_DISPLAY];
+
+#if SEVENSEG_TRACE
+   _dspUndrlHwPtr->trace(trcPrintBgn, trcPrintDbl);
+#endif
+   if (decPlaces <= _dspDigitsQty) {
+      for (unsigned int i{0}; i < decPlaces; i++)
+         scaledVal *= 10.0;
+      scaledVal += (scaledVal < 0.0)? -0.5 : 0.5;	//Rounding half away from zero, as the conversion truncates
+      if ((scaledVal > -2147483648.0) && (scaledVal < 2147483648.0))
+         displayable = renderFixed(frame, static_cast<int32_t>(scaledVal), static_cast<uint8_t>(decPlaces), rgtAlgn, zeroPad);
    }
+   loadDspBuff(displayable? frame : nullptr);
+#if SEVENSEG_STATS
+   ++_stats.printsCnt;
+   if(!displayable)
+      ++_stats.printsRjctd;
+#endif
+#if SEVENSEG_TRACE
+   _dspUndrlHwPtr->trace(trcPrintEnd, displayable? 1 : 0);
+#endif
 
    return displayable;
 }
 
-bool SevenSegDisplays::print(const double &value, const unsigned int &decPlaces, bool rgtAlgn, bool zeroPad){
-   bool displayable{true};
-   std::string readOut{""};
-   std::string pad{""};
+bool SevenSegDisplays::printFixed(const int32_t &mantissa, const uint8_t &scale, bool rgtAlgn, bool zeroPad){
+   bool displayable{false};
+   uint8_t frame[MAX_DIGITS_PER_DISPLAY];
+
+#if SEVENSEG_TRACE
+   _dspUndrlHwPtr->trace(trcPrintBgn, trcPrintFxd);
+#endif
+   displayable = renderFixed(frame, mantissa, scale, rgtAlgn, zeroPad);
+   loadDspBuff(displayable? frame : nullptr);
+#if SEVENSEG_STATS
+   ++_stats.printsCnt;
+   if(!displayable)
+      ++_stats.printsRjctd;
+#endif
+#if SEVENSEG_TRACE
+   _dspUndrlHwPtr->trace(trcPrintEnd, displayable? 1 : 0);
+#endif
 
-   if (decPlaces == 0)
-      displayable = print(int(value), rgtAlgn, zeroPad);
-   else if ((value < _dspValMin) || (value > _dspValMax) || (decPlaces > _dspDigitsQty)) {
-      displayable = false;
-      clear();
-   }
-   else if ((decPlaces + std::to_string(int(value)).length()) > static_cast<unsigned int>((((value > (-1)) && (value < 0)) ? (_dspDigitsQty - 1) : _dspDigitsQty))) {
-      displayable = false;
-      clear();
+   return displayable;
+}
+
+bool SevenSegDisplays::renderFixed(uint8_t* frame, const int32_t &mantissa, const uint8_t &scale, bool rgtAlgn, bool zeroPad){
+   // Renders the mantissa glyphs to the frame with scale decimal places, if the representation fits the display
+   bool result{false};
+   uint32_t absVal{(mantissa < 0)? (0U - static_cast<uint32_t>(mantissa)) : static_cast<uint32_t>(mantissa)};
+   uint8_t dgts[MAX_DIGITS_PER_DISPLAY];
+   uint8_t dgtsQty{0};
+   int8_t pos{0};
+
+   if (scale < _dspDigitsQty) {
+      do{
+         dgts[dgtsQty++] = absVal % 10;
+         absVal /= 10;
+      }while ((absVal != 0) && (dgtsQty < _dspDigitsQty));
+      while (dgtsQty <= scale)	//At least one integer part digit is displayed
+         dgts[dgtsQty++] = 0;
+      if ((absVal == 0) && ((dgtsQty + ((mantissa < 0)? 1 : 0)) <= _dspDigitsQty))
+         result = true;
    }
-   else {
-      if (value < 0 && value > -1)
-         readOut = "-";
-      readOut += std::to_string(int(value)) + ".";
-      int32_t powFactor = 1;
-      for (uint8_t i{0}; i < decPlaces; i++)
-         powFactor *= 10;
-      if(value < 0)
-      	readOut += std::to_string((-1)*(int((value - int(value))*powFactor)));
-      else
-         readOut += std::to_string(int((value - int(value))*powFactor));
+   if (result) {
+      for (uint8_t i{0}; i < _dspDigitsQty; i++)
+         frame[i] = SPACE_GLYPH;
       if (rgtAlgn) {
-         if (readOut.length() < static_cast<unsigned int>(_dspDigitsQty + 1)) {
-            if (value < 0)
-               pad += "-";
-            if (zeroPad)
-               pad += _zeroPadding;
-            else
-               pad += _spacePadding;
-            if (value < 0)
-               readOut = pad.substr(0, (_dspDigitsQty+1) - (readOut.length()-1)) + readOut.substr(1);
-            else
-               readOut = pad.substr(0, (_dspDigitsQty+1) - (readOut.length())) + readOut;
-            readOut = readOut.substr(0, _dspDigitsQty + 1);
+         for (uint8_t i{0}; i < dgtsQty; i++)
+            frame[i] = font.glyphs['0' + dgts[i]];
+         if (zeroPad){
+            for (pos = dgtsQty; pos < ((mantissa < 0)? (_dspDigitsQty - 1) : _dspDigitsQty); pos++)
+               frame[pos] = font.glyphs['0'];
+         }
+         if (mantissa < 0)
+            frame[_dspDigitsQty - 1] = font.glyphs['-'];
+         if (scale > 0)
+            frame[scale] &= DOT_GLYPH;
+      }
+      else {
+         pos = _dspDigitsQty - 1;
+         if (mantissa < 0)
+            frame[pos--] = font.glyphs['-'];
+         for (int8_t i{static_cast<int8_t>(dgtsQty - 1)}; i >= 0; i--){
+            frame[pos] = font.glyphs['0' + dgts[i]];
+            if ((scale > 0) && (i == scale))
+               frame[pos] &= DOT_GLYPH;
+            --pos;
          }
       }
-      displayable = print(readOut);
    }
 
-   return displayable;
+   return result;
 }
 
 void SevenSegDisplays::resetBlinkMask(){
@@ -556,24 +703,37 @@ void SevenSegDisplays::resetBlinkMask(){
    return;
 }
 
-void SevenSegDisplays::restoreDspBuff(){
+#if SEVENSEG_STATS
+void SevenSegDisplays::resetStats(){
    taskENTER_CRITICAL();
+   _stats = dspStats_t{};
+   taskEXIT_CRITICAL();
+
+   return;
+}
+#endif
+
+void SevenSegDisplays::restoreDspBuff(){
+   uint16_t chngdDgtsMsk{0};
+
+   crtclEnter();
 	for (int i{0}; i < _dspDigitsQty; i++){
    	 if((*(_dspBuffPtr + i)) != (*(_dspAuxBuffPtr + i))){
       	 (*(_dspBuffPtr + i)) = (*(_dspAuxBuffPtr + i));
-       	_dspUndrlHwPtr -> dspBffrCntntChng();
+      	 chngdDgtsMsk |= (uint16_t(1) << i);
    	 }
     }
-	taskEXIT_CRITICAL();
+	crtclExit();
+	notifyDspBuffChng(chngdDgtsMsk);
 
     return;
 }
 
 void SevenSegDisplays::saveDspBuff(){
-   taskENTER_CRITICAL();
+   crtclEnter();
     for (int i{0}; i < _dspDigitsQty; i++)
         (*(_dspAuxBuffPtr + i)) = (*(_dspBuffPtr + i));
-    taskEXIT_CRITICAL();
+    crtclExit();
 
    return;
 }
@@ -591,20 +751,10 @@ void SevenSegDisplays::setAttrbts(){
    _dspValMax = 1; // Calculate the maximum integer value displayable with this display's available digits, create a Zero and a Space padding string for right alignment
    for (uint8_t i{0}; i < _dspDigitsQty; i++) {
       _dspValMax *= 10;
-      _zeroPadding += "0";
-      _spacePadding += " ";
       *(_blinkMaskPtr + i) = true;
    }
    --_dspValMax;
 
-   if (!_dspUndrlHwPtr->getCommAnode()) {
-		_waitChar = ~_waitChar;
-      _space = ~_space;
-      _dot = ~_dot;
-      for (int i{0}; i < (int)_charSet.length(); i++)
-         _charLeds[i] = ~_charLeds[i];
-   }
-
    return;
 }
 
@@ -618,7 +768,6 @@ void SevenSegDisplays::setBlinkMask(const bool* newBlnkMsk){
 bool SevenSegDisplays::setBlinkRate(const unsigned long &newOnRate, const unsigned long &newOffRate){
    bool result {false};
    long unsigned tmpOffRate{newOffRate};
-   BaseType_t tmrModResult {pdFAIL};
 
    if (tmpOffRate == 0)
       tmpOffRate = newOnRate;
@@ -629,17 +778,7 @@ bool SevenSegDisplays::setBlinkRate(const unsigned long &newOnRate, const unsign
                _blinkOnRate = newOnRate;
             if(_blinkOffRate != tmpOffRate)
                _blinkOffRate = tmpOffRate;
-            _blinkRatesGCD = blinkTmrGCD(newOnRate, tmpOffRate);
-            result =  true;
-
-            if(_blinking){ // If it's active and running modify the timer taking care of the blinking
-               tmrModResult = xTimerChangePeriod(_blinkTmrHndl,
-                              pdMS_TO_TICKS(_blinkRatesGCD),
-                              portMAX_DELAY
-                              );
-               if(tmrModResult == pdFAIL)
-                  result = false;	// The new period could not be imposed to the running timer, BUT the blinker times are set for future use
-            }
+            result =  true;	//If blinking, the new rates take effect from the next blinking stage
          }
       }
    }
@@ -652,16 +791,10 @@ bool SevenSegDisplays::setBlinkRate(const unsigned long &newOnRate, const unsign
 
 bool SevenSegDisplays::setWaitChar (const char &newChar){
     bool result {false};
-    int position {-1};
+    uint8_t glyph {font.glyphs[static_cast<uint8_t>(newChar)]};
 
-   if(_waitChar != newChar){
-      position = _charSet.find(newChar);
-      if (position > -1) {
-         _waitChar = _charLeds[position];
-         result = true;
-      }
-   }
-   else{
+   if (glyph != NO_GLYPH) {
+      _waitChar = glyph;
       result = true;
    }
 
@@ -670,21 +803,11 @@ bool SevenSegDisplays::setWaitChar (const char &newChar){
 
 bool SevenSegDisplays::setWaitRate(const unsigned long &newWaitRate){
    bool result {false};
-   BaseType_t tmrModResult {pdFAIL};
 
    if(_waitRate != newWaitRate){
-      if ((newWaitRate >= _minBlinkRate) && newWaitRate <= _maxBlinkRate) {//if the new waitRate is within the accepted range, set it
+      if ((newWaitRate >= _minBlinkRate) && newWaitRate <= _maxBlinkRate) {//if the new waitRate is within the accepted range, set it. If waiting, it takes effect from the next waiting update
          _waitRate = newWaitRate;
          result =  true;
-
-         if(_waiting){  // If it's active and running modify the timer taking care of the blinking
-            tmrModResult = xTimerChangePeriod(_waitTmrHndl,
-                           pdMS_TO_TICKS(_waitRate),
-                           portMAX_DELAY
-                           );
-            if(tmrModResult == pdFAIL)
-               result =  true;	//It's completely unneeded but there's not defined answer to the successful change of waitRate but failure in imposing it to a running wait timer.
-         }
       }
    }
    else{
@@ -694,80 +817,138 @@ bool SevenSegDisplays::setWaitRate(const unsigned long &newWaitRate){
    return result;
 }
 
-void SevenSegDisplays::tmrCbBlink(TimerHandle_t blinkTmrCbArg){
-   SevenSegDisplays* dispObj = (SevenSegDisplays*)pvTimerGetTimerID(blinkTmrCbArg);
-
-   dispObj->updBlinkState();
+void SevenSegDisplays::tmrCbAnim(TimerHandle_t animTmrCbArg){
+   //Timer Callback to advance every display animation effect due, then the timer is reprogrammed to the earliest effect update pending
+   //The scheduler is kept suspended while the displays registry is walked, so no task destroys a display being updated. The updates never block
+   TickType_t curTck{xTaskGetTickCount()};
+   SevenSegDisplays* dispObj{nullptr};
+
+   vTaskSuspendAll();
+   for(uint8_t i{0}; i < _dspPtrArrLngth; i++){
+      dispObj = *(_instancesLstPtr + i);
+      if(dispObj){
+         if(dispObj->_blinking && tckReached(curTck, dispObj->_blinkNxtTck))
+            dispObj->updBlinkState();
+         if(dispObj->_waiting && tckReached(curTck, dispObj->_waitNxtTck))
+            dispObj->updWaitState();
+      }
+   }
+   xTaskResumeAll();
+   updAnimTmr(0);	//If the command can't be queued the auto-reload timer expires again with it's current period, and the reprogramming is retried then
 
    return;
+}
 
+bool SevenSegDisplays::tckReached(const TickType_t &curTck, const TickType_t &trgtTck){
+
+   return static_cast<TickType_t>(curTck - trgtTck) < (portMAX_DELAY >> 1);	//Tick count overflow safe comparison
 }
 
-void SevenSegDisplays::tmrCbWait(TimerHandle_t waitTmrCbArg){
-   SevenSegDisplays* dispObj = (SevenSegDisplays*)pvTimerGetTimerID(waitTmrCbArg);
+BaseType_t SevenSegDisplays::updAnimTmr(const TickType_t &blockTm){
+   BaseType_t result{pdPASS};
+   TickType_t curTck{0};
+   TickType_t nxtTck{0};
+   TickType_t tmpTck{0};
+   bool pndngUpd{false};
+   SevenSegDisplays* dispObj{nullptr};
 
-   dispObj-> updWaitState();
+   taskENTER_CRITICAL();
+   curTck = xTaskGetTickCount();
+   for(uint8_t i{0}; i < _dspPtrArrLngth; i++){
+      dispObj = *(_instancesLstPtr + i);
+      if(dispObj && (dispObj->_blinking || dispObj->_waiting)){
+         tmpTck = (dispObj->_blinking)? dispObj->_blinkNxtTck : dispObj->_waitNxtTck;
+         if(dispObj->_blinking && dispObj->_waiting && !tckReached(dispObj->_waitNxtTck, tmpTck))
+            tmpTck = dispObj->_waitNxtTck;
+         if(!pndngUpd || !tckReached(tmpTck, nxtTck))
+            nxtTck = tmpTck;
+         pndngUpd = true;
+      }
+   }
+   taskEXIT_CRITICAL();
+   if(pndngUpd){
+      tmpTck = tckReached(curTck, nxtTck)? 1 : (nxtTck - curTck);
+      result = xTimerChangePeriod(_animTmrHndl, tmpTck, blockTm);	//Changing the period also starts the timer
+   }
+   else if(xTimerIsTimerActive(_animTmrHndl)){
+      result = xTimerStop(_animTmrHndl, blockTm);
+   }
 
-   return;
+   return result;
 }
 
 void SevenSegDisplays::updBlinkState(){
+   //Each invocation switches the blinking stage, and sets the next update tick to the exact end of the stage started
+   TickType_t curTck{xTaskGetTickCount()};
+   uint16_t chngdDgtsMsk{0};
+
    if (_blinking == true){
-      if (_blinkShowOn == false) {
-         if (_blinkTimer == 0){
-            //The turn-Off display stage of the blinking started, copy the dspBuff contents to the dspAuxBuff before blanking the appropriate ports
-            saveDspBuff();
-            //turn off the digits by placing a space to each corresponding position of the buffer
-            for (int i{0}; i < _dspDigitsQty; i++)
-               if(*(_blinkMaskPtr + i))
-                  *(_dspBuffPtr + i) = _space;
-            _blinkTimer = xTaskGetTickCount() / portTICK_RATE_MS; //Starts the count for the blinkRate control
-         	_dspUndrlHwPtr -> dspBffrCntntChng();
-         }
-         else if((xTaskGetTickCount() / portTICK_RATE_MS - _blinkTimer) >= _blinkOffRate){
-            _blinkTimer = 0;
-            _blinkShowOn = true;
+#if SEVENSEG_STATS
+      ++_stats.blinkTcks;
+#endif
+      if (_blinkShowOn == true) {
+         //The turn-Off display stage of the blinking starts, copy the dspBuff contents to the dspAuxBuff before blanking the appropriate ports
+         saveDspBuff();
+         //turn off the digits by placing a space to each corresponding position of the buffer
+         for (int i{0}; i < _dspDigitsQty; i++){
+            if(*(_blinkMaskPtr + i) && (*(_dspBuffPtr + i) != SPACE_GLYPH)){
+               *(_dspBuffPtr + i) = SPACE_GLYPH;
+               chngdDgtsMsk |= (uint16_t(1) << i);
+            }
          }
+         _blinkShowOn = false;
+         _blinkNxtTck += pdMS_TO_TICKS(_blinkOffRate);
+      	notifyDspBuffChng(chngdDgtsMsk);
       }
       else{
-         if (_blinkTimer == 0){
-            //The turn-On display stage of the blinking started, restore the dspBuff contents from the dspAuxBuff
-            restoreDspBuff();
-            _blinkTimer = xTaskGetTickCount() / portTICK_RATE_MS;
-         	_dspUndrlHwPtr -> dspBffrCntntChng();
-         }
-         else if((xTaskGetTickCount() / portTICK_RATE_MS - _blinkTimer) >= _blinkOnRate){
-            _blinkTimer = 0;
-            _blinkShowOn = false;
-         }
+         //The turn-On display stage of the blinking starts, restore the dspBuff contents from the dspAuxBuff
+         restoreDspBuff();
+         _blinkShowOn = true;
+         _blinkNxtTck += pdMS_TO_TICKS(_blinkOnRate);
       }
+      if(tckReached(curTck, _blinkNxtTck))	//The update was delayed more than the stage length, resynchronize to avoid a burst of updates
+         _blinkNxtTck = curTck + pdMS_TO_TICKS(_blinkShowOn? _blinkOnRate : _blinkOffRate);
+#if SEVENSEG_TRACE
+      _dspUndrlHwPtr->trace(trcBlinkTgl, _blinkShowOn? 1 : 0);
+#endif
    }
 
    return;
 }
 
 void SevenSegDisplays::updWaitState(){
+   uint16_t chngdDgtsMsk{0};
+   uint8_t tmpGlyph{SPACE_GLYPH};
+
    if (_waiting == true){
+#if SEVENSEG_STATS
+      ++_stats.waitTcks;
+#endif
       if (_waitTimer == 0){
          clear();
          _waitTimer = xTaskGetTickCount()/portTICK_RATE_MS;
       }
       else if((xTaskGetTickCount()/portTICK_RATE_MS - _waitTimer) >= _waitRate){
-         taskENTER_CRITICAL();
+         crtclEnter();
       	for (int i{_dspDigitsQty - 1}; i >= 0; i--){
-            if(( _dspDigitsQty - i) <= _waitCount)
-               *(_dspBuffPtr + i) = _waitChar;
-            else
-               *(_dspBuffPtr + i) = _space;
+            tmpGlyph = (( _dspDigitsQty - i) <= _waitCount)? _waitChar : SPACE_GLYPH;
+            if(*(_dspBuffPtr + i) != tmpGlyph){
+               *(_dspBuffPtr + i) = tmpGlyph;
+               chngdDgtsMsk |= (uint16_t(1) << i);
+            }
          }
-      	taskEXIT_CRITICAL();
-      	_dspUndrlHwPtr -> dspBffrCntntChng();
+      	crtclExit();
+      	notifyDspBuffChng(chngdDgtsMsk);
+#if SEVENSEG_TRACE
+         _dspUndrlHwPtr->trace(trcWaitTgl, _waitCount);
+#endif
 
          _waitCount++;
          if (_waitCount == (_dspDigitsQty + 1))
             _waitCount = 0;
          _waitTimer = xTaskGetTickCount()/portTICK_RATE_MS;
       }
+      _waitNxtTck = xTaskGetTickCount() + pdMS_TO_TICKS(_waitRate);
    }
 
    return;
@@ -775,39 +956,25 @@ void SevenSegDisplays::updWaitState(){
 
 bool SevenSegDisplays::wait(){
    bool result {false};
-   BaseType_t tmrModResult {pdFAIL};
 
    if(!_waiting){   //If the display is waiting the blinking option is blocked out as they are mutually exclusive, as both simultaneous has no logical use!
-      //Create a valid unique Name for identifying the timer created
-      std::string waitTmrNameStr{ "Disp" };
-      std::string dspSerialNumStr{ "00" + std::to_string(_dspSerialNum) };
-      dspSerialNumStr = dspSerialNumStr.substr(dspSerialNumStr.length() - 2, 2);
-      waitTmrNameStr = waitTmrNameStr + dspSerialNumStr + "wait_tmr";
-
-      if (!_waitTmrHndl){
-			_waitTmrHndl = xTimerCreate(
-				waitTmrNameStr.c_str(),
-				pdMS_TO_TICKS(_waitRate),
-				pdTRUE,  //Autoreload
-				_dspInstance,   //TimerID, data to be passed to the callback function
-				tmrCbWait  //Callback function
-			);
-      }
-      if(_waitTmrHndl && (!xTimerIsTimerActive(_waitTmrHndl))){
-			// The timer was created, but it wasn't started. Start the timer
-			tmrModResult = xTimerStart(_waitTmrHndl, portMAX_DELAY);
-			if (tmrModResult == pdPASS)
+		if(!_animTmrHndl)
+			createAnimTmr();
+		if(_animTmrHndl){
+			if (_blinking)
+				noBlink();
+			saveDspBuff();
+			_waitCount = 0;
+			_waitTimer = 0;  //Start the waiting pace timer...
+			_waitNxtTck = xTaskGetTickCount() + pdMS_TO_TICKS(_waitRate);
+			_waiting = true;
+			if (updAnimTmr(portMAX_DELAY) == pdPASS){
 				result = true;
-      }
-
-      if (_blinking)
-         noBlink();
-      _dspAuxBuffPtr = new uint8_t[_dspDigitsQty];
-      saveDspBuff();
-      _waitCount = 0;
-      _waitTimer = 0;  //Start the blinking pace timer...
-      _waiting = true;
-      result = true;
+			}
+			else{
+				_waiting = false;
+			}
+		}
     }
    else{
    	result = true;
@@ -841,14 +1008,14 @@ bool SevenSegDisplays::write(const uint8_t &segments, const uint8_t &port){
    if(_waiting)
       noWait();
 	if (port < _dspDigitsQty){
-		taskENTER_CRITICAL();
-		if(writeOnBlink)
+		if(writeOnBlink)	//Restarting the blinking reprograms the animation timer, must be done out of the critical section
 			noBlink();
+		crtclEnter();
 		*(_dspBuffPtr + port) = segments;
+		crtclExit();
 		if(writeOnBlink)
 			blink();
-		taskEXIT_CRITICAL();
-   	_dspUndrlHwPtr -> dspBffrCntntChng();
+   	notifyDspBuffChng(uint16_t(1) << port);
 		result = true;
 	}
 
@@ -857,14 +1024,12 @@ bool SevenSegDisplays::write(const uint8_t &segments, const uint8_t &port){
 
 bool SevenSegDisplays::write(const std::string &character, const uint8_t &port){
    bool result {false};
-   int position {-1};
+   uint8_t glyph {NO_GLYPH};
 
-   if (port < _dspDigitsQty){
-      position = _charSet.find(character);
-      if (position > -1) { // Character found for translation
-      	result = write(_charLeds[position], port);
-         result = true;
-      }
+   if ((port < _dspDigitsQty) && (character.length() == 1)){
+      glyph = font.glyphs[static_cast<uint8_t>(character.at(0))];
+      if (glyph != NO_GLYPH) // Character found for translation
+      	result = write(glyph, port);
     }
 
    return result;
@@ -21,7 +21,7 @@
 #ifndef _SEVENSEGDISPLAYS_STM32_H_
 	#define _SEVENSEGDISPLAYS_STM32_H_
 
-#include "SevenSegDispHw.h"
+#include "sevenSegDispHw.h"
 
 #include <string>
 //===========================>> Next lines included for developing purposes, corresponding headers must be provided for the production platform/s
@@ -41,6 +41,23 @@
 const int MAX_DIGITS_PER_DISPLAY{16};
 const int MAX_DISPLAYS_QTY{16};
 
+#if SEVENSEG_STATS
+/**
+ * @brief Logical display performance counters, see SevenSegDisplays::getStats()
+ *
+ * @struct dspStats_t
+ */
+struct dspStats_t{
+	uint32_t printsCnt;	/**< print() and printFixed() invocations, including the ones made by the gauges*/
+	uint32_t printsRjctd;	/**< print() and printFixed() invocations rejected as not displayable, the display was cleared instead*/
+	uint32_t hwNtfctnsCnt;	/**< Change notifications sent to the underlying hardware display*/
+	uint32_t crtclSctnsCnt;	/**< Critical sections executed over the display buffers*/
+	uint64_t crtclSctnsCyc;	/**< CPU cycles spent inside those critical sections, nanoseconds on the host stand-in build. Divide by statsCycPerUs() to get microseconds*/
+	uint32_t blinkTcks;	/**< Blinking stages switched by the animation timer*/
+	uint32_t waitTcks;	/**< Waiting animation updates executed by the animation timer*/
+};
+#endif
+
 //============================================================> Class declarations separator
 
 /**
@@ -54,16 +71,30 @@ class SevenSegDisplays {
     static uint8_t _displaysCount;
     static uint16_t _dspSerialNum;
     static uint8_t _dspPtrArrLngth;
+    static SevenSegDisplays* _instancesLst[MAX_DISPLAYS_QTY];
     static SevenSegDisplays** _instancesLstPtr;
+    static TimerHandle_t _animTmrHndl;	//Single timer advancing the blinking and waiting effects of all the displays
+#if configSUPPORT_STATIC_ALLOCATION
+    static StaticTimer_t _animTmrBffr;
+#endif
 
-    static void tmrCbBlink(TimerHandle_t blinkTmrCbArg);
-    static void tmrCbWait(TimerHandle_t waitTmrCbArg);
+    static void createAnimTmr();
+    static bool tckReached(const TickType_t &curTck, const TickType_t &trgtTck);
+    static void tmrCbAnim(TimerHandle_t animTmrCbArg);
+    static BaseType_t updAnimTmr(const TickType_t &blockTm);
 private:
-    uint8_t _waitChar {0xBF};
+    bool _bffrsOwnd{true};	//The display buffers were allocated by the object
+    uint8_t _waitChar {0xBF};  //Glyph in the font encoding, as every value held in the display buffers
     uint8_t _waitCount {0};
     bool _waiting {false};
+    TickType_t _waitNxtTck {0};
     unsigned long _waitRate {250};
     unsigned long _waitTimer {0};
+#if SEVENSEG_STATS
+    uint8_t _crtclNstng{0};
+    uint32_t _crtclStrtCyc{0};
+    dspStats_t _stats{};
+#endif
 protected:
     const unsigned long _minBlinkRate{100};
     const unsigned long _maxBlinkRate{2000};
@@ -71,11 +102,9 @@ protected:
     bool _blinking{false};
     bool* _blinkMaskPtr{nullptr};
     bool _blinkShowOn{false};
+    TickType_t _blinkNxtTck{0};  //Tick of the next blinking stage switch, the animation timer expires exactly at the end of each turn-On and turn-Off stage
     unsigned long _blinkOffRate{500};
     unsigned long _blinkOnRate{500};
-    unsigned long _blinkRatesGCD{500};  //Holds the value for the minimum timer checking the change ON/OFF of the blinking, saving unneeded timer interruptions, and without the need of the std::gcd function.
-    unsigned long _blinkTimer{0};
-    TimerHandle_t _blinkTmrHndl{NULL};
     uint8_t* _dspAuxBuffPtr{nullptr};
     uint8_t* _dspBuffPtr{nullptr};
     uint8_t _dspDigitsQty{};
@@ -84,67 +113,30 @@ protected:
     uint16_t _dspInstNbr{0};
     int32_t _dspValMax{};
     int32_t _dspValMin{};
-    std::string _charSet{"0123456789AabCcdEeFGHhIiJLlnOoPqrStUuY-_=~* ."}; // for using indexOf() method
-    uint8_t _charLeds[45] = {   //Values valid for a Common Anode display. For a Common Cathode display values must be logically bit negated
-        0xC0, // 0
-        0xF9, // 1
-        0xA4, // 2
-        0xB0, // 3
-        0x99, // 4
-        0x92, // 5
-        0x82, // 6
-        0xF8, // 7
-        0x80, // 8
-        0x90, // 9
-        0x88, // A
-        0xA0, // a
-        0x83, // b
-        0xC6, // C
-        0xA7, // c
-        0xA1, // d
-        0x86, // E
-        0x84, // e
-        0x8E, // F
-        0xC2, // G
-        0x89, // H
-        0x8B, // h
-        0xF9, // I
-        0xFB, // i
-        0xF1, // J
-        0xC7, // L
-        0xCF, // l
-        0xAB, // n
-        0xC0, // O
-        0xA3, // o
-        0x8C, // P
-        0x98, // q
-        0xAF, // r
-        0x92, // S
-        0x87, // t
-        0xC1, // U
-        0xE3, // u
-        0x91, // Y
-        0xBF, // Minus -
-        0xF7, // Underscore _
-        0xB7, // Low =
-        0xB6, //~ for Equivalent symbol
-        0x9C, // °
-        0xFF, // Space
-        0x7F  //.
-    };
-    uint8_t _dot {0x7F};
-    uint8_t _space {0xFF};
-    std::string _spacePadding{""};
-    TimerHandle_t _waitTmrHndl{NULL};
-    std::string _zeroPadding{""};
 
-    unsigned long blinkTmrGCD(unsigned long blnkOnTm, unsigned long blnkOffTm);
+    void crtclEnter();
+    void crtclExit();
+    void loadDspBuff(const uint8_t* newContents);
+    void notifyDspBuffChng(const uint16_t &chngdDgtsMsk);
+    bool renderFixed(uint8_t* frame, const int32_t &mantissa, const uint8_t &scale, bool rgtAlgn, bool zeroPad);
     void restoreDspBuff();
     void saveDspBuff();
     void setAttrbts();
     void updBlinkState();
     void updWaitState();
 
+    /**
+     * @brief Class constructor for the subclasses providing the display buffers
+     *
+     * @param dspUndrlHwPtr A pointer to the underlying hardware display, see SevenSegDisplays(SevenSegDispHw*).
+     * @param dspBuffPtr Pointer to the display's data buffer. If nullptr the display buffers are allocated by the object, and the rest of the buffer parameters are ignored.
+     * @param dspAuxBuffPtr Pointer to the auxiliary display buffer, used to keep the display contents while blinking and waiting.
+     * @param blinkMaskPtr Pointer to the blink mask buffer.
+     * @param bffrsLngth Length of the provided buffers.
+     *
+     * @note If the provided buffers length is less than the underlying hardware display digits quantity, or the latter is greater than MAX_DIGITS_PER_DISPLAY, the display is not built, as happens when MAX_DISPLAYS_QTY displays are already instantiated.
+     */
+    SevenSegDisplays(SevenSegDispHw* dspUndrlHwPtr, uint8_t* dspBuffPtr, uint8_t* dspAuxBuffPtr, bool* blinkMaskPtr, uint8_t bffrsLngth);
 public:
     /**
      * @brief Class constructor
@@ -159,6 +151,8 @@ public:
      *  - Quantity and position of semicolons, apostrophes and special icons.
      *  - Managed brightness levels.
      *  - Display color change.
+     *
+     * @note If the underlying hardware display digits quantity is greater than MAX_DIGITS_PER_DISPLAY the display is not built, as happens when MAX_DISPLAYS_QTY displays are already instantiated.
      */
     SevenSegDisplays(SevenSegDispHw* dspUndrlHwPtr);
     /**
@@ -327,6 +321,16 @@ public:
      *
      * @note This value is also the minimum parameter accepted by the following methods: blink(const unsigned long, const unsigned long), setBlinkRate(const unsigned long, const unsigned long), wait(const unsigned long) and setWaitRate(const unsigned long)     */
     unsigned long getMinBlinkRate();
+#if SEVENSEG_STATS
+    /**
+     * @brief Gets the display performance counters
+     *
+     * Built only when SEVENSEG_STATS is set to 1. The underlying hardware display keeps it's own bus level counters, see SevenSegDispHw::getStats().
+     *
+     * @return The counters accumulated since the object instantiation or the last resetStats().
+     */
+    dspStats_t getStats();
+#endif
     /**
      * @brief Returns a value indicating if the display is blank
      *
@@ -355,17 +359,16 @@ public:
      * @brief Stops the display blinking, if it was doing so, leaving the display turned on.
      *
      * @retval true: The display is set not to blink.
-     * @retval false: The display was set to blink but the blinking couldn't be stopped due to timer management failures.
-     * @warning The failure of the method might indicate a bug in the development. Direct manipulation of the handles and pointers to the resources (or the resources themselves) used by the blinking mechanism might disable this method capabilities to correctly exiting the **blinking state**
+     *
+     * @note The library-wide animation timer is not modified, the display is skipped by it from it's next expiration.
      */
     bool noBlink();
     /**
      * @brief Stops the **waiting mode** in process, if the display was in it.
      *
      * @retval true: The display is set out of **waiting mode**, and the waiting is stopped.
-     * @retval false: The display was set to wait, but the waiting couldn't be stopped due to timer management failures.
      *
-     * @warning The failure of the method might indicate a bug in the development. Direct manipulation of the handles and pointers to the resources (or the resources themselves) used by the waiting mechanism might disable this method capabilities to correctly exiting the **waiting state**
+     * @note The library-wide animation timer is not modified, the display is skipped by it from it's next expiration.
       */
     bool noWait();
     /**
@@ -405,6 +408,7 @@ public:
      * @retval true: The value could be represented.
      * @retval false: The value couldn't be represented, and the display will be blanked.
      *
+     * @note The digits are rendered straight to a stack held frame, with no strings or heap involved, so the method is suitable to be invoked at high rates.
      */
     bool print(const int32_t &value, bool rgtAlgn = false, bool zeroPad = false);
     /**
@@ -413,20 +417,42 @@ public:
      * The value will be displayed as long as the length representation fits the available space of the display. If the integer part of value is not in the displayable range or if the sum of the spaces needed by the integer part plus the indicated decimal places to display is greater than the available digits space, the method will fail.
      *
      * @param value The floating point value to display, which must be in the range ((-1)*(pow(10, ((dspDigits - decPlaces) - 1)) - 1)) <= value <= (pow(10, (dspDigits - decPlaces)) - 1).
-     * @param decPlaces Decimal places to be displayed after the decimal point, ranging 0 <= decPlaces < dspDigits, selecting 0 value will display the number as an integer, with no '.' displayed. In any case the only modification that will be applied if value has a decimal part longer than the decPlaces number of digits is **truncation**, if any other rounding criteria is desired the developer must apply it to **value** before calling this method.
+     * @param decPlaces Decimal places to be displayed after the decimal point, ranging 0 <= decPlaces < dspDigits, selecting 0 value will display the number as an integer, with no '.' displayed. If value has a decimal part longer than the decPlaces number of digits it will be **rounded** half away from zero.
      * @param rgtAlgn Right alignement, see print(const int32_t, bool, bool)
      * @param zeroPad Zero padding, see print(const int32_t, bool, bool)
      *
      * @retval true: The value could be represented.
      * @retval false: The value couldn't be represented, and the display will be blanked.
+     *
+     * @note The value is scaled and rounded to a fixed point mantissa, and then displayed by printFixed(const int32_t, const uint8_t, bool, bool), so no strings or heap are involved.
      */
     bool print(const double &value, const unsigned int &decPlaces, bool rgtAlgn = false, bool zeroPad = false);
+    /**
+     * @brief Displays a fixed point value.
+     *
+     * The value displayed is mantissa / pow(10, scale), always showing **scale** decimal places after the decimal point, as long as the length representation fits the available space of the display. The value needs no floating point arithmetic to be displayed, as the digits and the decimal point are rendered straight to the display buffer, being the preferred method for high rate displaying of process values.
+     *
+     * @param mantissa The integer value to display as a fixed point value, i.e. the value 12.34 is displayed with a 1234 mantissa and a scale of 2.
+     * @param scale Decimal places to be displayed after the decimal point, selecting 0 value will display the mantissa as an integer, with no '.' displayed.
+     * @param rgtAlgn Right alignement, see print(const int32_t, bool, bool)
+     * @param zeroPad Zero padding, see print(const int32_t, bool, bool)
+     *
+     * @retval true: The value could be represented.
+     * @retval false: The value couldn't be represented -the sign, the integer part digits (at least one) and the decimal places exceed the display digits quantity-, and the display will be blanked.
+     */
+    bool printFixed(const int32_t &mantissa, const uint8_t &scale, bool rgtAlgn = false, bool zeroPad = false);
     /**
      * @brief Resets the blinking mask.
      *
      * The blinking mask configures which digits of the display will be affected by the blink() method, resetting the mask will restore the original setting by which all the ports of the display will be affected when **blinking mode** is active.
      */
     void resetBlinkMask();
+#if SEVENSEG_STATS
+    /**
+     * @brief Clears the display performance counters
+     */
+    void resetStats();
+#endif
     /**
      * @brief Modifies the blinking mask.
      *
@@ -478,9 +504,11 @@ public:
      *
      * The simple animation mechanism has as it's main purpose to show the final user the system is working and not in any "hang" situation. As in most O.S. progress bar animation, the sequence starts with  a blank display and a defined character is added from left to right at a configured pace, until all the ports are lit, starting over with the display blanking. The rate at which the characters are added and the character used for display are both configurable (see `setWaitChar(const char)` and setWaitRate(const unsigned long) for details).
      *
-     * @retval true: The display was not in **waiting mode** and the required timer could be attached. The **waiting mode** is started.
-     * @retval false: The display was in **waiting mode**, no change was made.
-     * @retval false: The timer couldn't be attached, the display wasn't set to **wait mode**
+     * @retval true: The display was not in **waiting mode** and the library-wide animation timer could be set. The **waiting mode** is started.
+     * @retval true: The display was in **waiting mode**, no change was made.
+     * @retval false: The animation timer couldn't be set, the display wasn't set to **wait mode**
+     *
+     * @note The blinking and waiting effects of all the displays are advanced by a single library-wide FreeRTOS auto-reload timer, reprogrammed after each expiration to the earliest effect update pending. If the reprogramming can't be queued the timer expires again with it's previous period, so the effects are delayed but never stopped.
      */
     bool wait();
     /**
@@ -503,7 +531,7 @@ public:
      * @retval true: The parameters are within the acceptable range, in this case 0 <= port < dspDigits.
      * @retval false: The port value was outside the acceptable range.
      *
-     * @note The corresponding value can be looked up in the **_charLeds[]** array definition in the header file of the library. In the case of a common cathode display the values there listed must be complemented. Any other uint8_t (char or unsigned short int is the same here) value is admissible, but the displayed result might not be easily recognized as a known ASCII character, but might be useful to display pre-defined special **pre-defined significance** characters.
+     * @note The corresponding value can be looked up in the **font** glyphs table definition in the source file of the library. The values are expressed in the font encoding -the common anode display encoding- independently of the display wiring scheme, as the underlying hardware applies it's polarity when outputting the buffer contents. Any other uint8_t (char or unsigned short int is the same here) value is admissible, but the displayed result might not be easily recognized as a known ASCII character, but might be useful to display pre-defined special **pre-defined significance** characters.
      */
     bool write(const uint8_t &segments, const uint8_t &port);
     /**
@@ -521,6 +549,48 @@ public:
 
 //============================================================> Class declarations separator
 
+/**
+ * @brief Display buffers embedded in the SevenSegDisplaysStatic objects
+ *
+ * Being a base class of SevenSegDisplaysStatic preceding SevenSegDisplays, the buffers are already in place when the SevenSegDisplays constructor initializes them.
+ *
+ * @struct SevenSegDspBffrs
+ */
+template <uint8_t dspDigits>
+struct SevenSegDspBffrs{
+	uint8_t _dspBuff[dspDigits];
+	uint8_t _dspAuxBuff[dspDigits];
+	bool _blinkMask[dspDigits];
+};
+
+/**
+ * @brief Models seven segment display class objects sized at compile time.
+ *
+ * The class offers the SevenSegDisplays API, with all the display buffers embedded in the object, so no heap is used by the display after it's instantiation. Statically allocated objects have their whole memory footprint determined at link time.
+ *
+ * @tparam dspDigits The underlying hardware display digits quantity.
+ *
+ * @warning If the underlying hardware display digits quantity is greater than dspDigits the display is not built.
+ *
+ * @class SevenSegDisplaysStatic
+ */
+template <uint8_t dspDigits>
+class SevenSegDisplaysStatic: private SevenSegDspBffrs<dspDigits>, public SevenSegDisplays{
+	static_assert((dspDigits > 0) && (dspDigits <= MAX_DIGITS_PER_DISPLAY), "SevenSegDisplaysStatic digits quantity out of range");
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param dspUndrlHwPtr A pointer to the underlying hardware display, see SevenSegDisplays(SevenSegDispHw*).
+	 */
+	SevenSegDisplaysStatic(SevenSegDispHw* dspUndrlHwPtr)
+	:SevenSegDisplays(dspUndrlHwPtr, this->_dspBuff, this->_dspAuxBuff, this->_blinkMask, dspDigits)
+	{
+	}
+};
+
+//============================================================> Class declarations separator
+
 /**
  * @brief Models Click Counter (a.k.a. Tally Counter) class objects.
  *